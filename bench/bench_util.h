@@ -0,0 +1,87 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+using Clock = std::chrono::steady_clock;
+
+inline double SecondsSince(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+// Keeps the optimizer from discarding a result that is otherwise unused.
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+// argv[idx] as a positive integer, or fallback when absent/invalid.
+inline long ArgOr(int argc, char** argv, int idx, long fallback)
+{
+    if (idx >= argc) return fallback;
+    const long v = std::strtol(argv[idx], nullptr, 10);
+    return v > 0 ? v : fallback;
+}
+
+struct Result {
+    std::string name;
+    std::size_t batch = 1;     // elements processed per call
+    uint64_t iterations = 0;   // calls
+    double seconds = 0.0;
+
+    double NsPerElement() const
+    {
+        return seconds * 1e9 / (static_cast<double>(iterations) * static_cast<double>(batch));
+    }
+    double ElementsPerSecond() const
+    {
+        return static_cast<double>(iterations) * static_cast<double>(batch) / seconds;
+    }
+};
+
+// Calls fn() repeatedly, doubling the iteration count until one timed run
+// lasts at least min_seconds.
+template <typename F>
+inline Result Measure(const std::string& name, std::size_t batch, double min_seconds, F&& fn)
+{
+    uint64_t iters = 1;
+    for (;;) {
+        const auto t0 = Clock::now();
+        for (uint64_t i = 0; i < iters; ++i) fn();
+        const double s = SecondsSince(t0);
+        if (s >= min_seconds || iters >= (uint64_t{1} << 40)) {
+            return Result{name, batch, iters, s};
+        }
+        iters *= (s > 0.0 && s < min_seconds / 8) ? 8 : 2;
+    }
+}
+
+// {"schema": 1, "benchmarks": [...]} - stable keys for regression tracking
+inline void WriteJson(std::FILE* fp, const std::vector<Result>& results)
+{
+    std::fprintf(fp, "{\n  \"schema\": 1,\n  \"benchmarks\": [\n");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::fprintf(fp,
+            "    {\"name\": \"%s\", \"batch\": %zu, \"iterations\": %llu, "
+            "\"seconds\": %.6f, \"ns_per_element\": %.4f, \"elements_per_second\": %.6e}%s\n",
+            r.name.c_str(), r.batch, static_cast<unsigned long long>(r.iterations),
+            r.seconds, r.NsPerElement(), r.ElementsPerSecond(),
+            (i + 1 < results.size()) ? "," : "");
+    }
+    std::fprintf(fp, "  ]\n}\n");
+}
+
+} // namespace Bench
@@ -0,0 +1,117 @@
+// Com shared-memory transport latency.
+//  1. publish + read cost of one ShmRing in a single thread (no contention)
+//  2. cross-process ping-pong: the parent publishes VehicleState on a private
+//     segment, a forked child busy-polls it and echoes the stamp back on the
+//     input ring. The child reports the one-way latency it observed, the
+//     parent the round trip. Both poll with yield, so on a single core the
+//     numbers are dominated by context switches.
+//
+// usage: com_bench [round_trips=100000]
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "bsw/com.h"
+#include "bsw/profiler.h"
+
+namespace {
+
+void PrintLatency(const char* name, const Bsw::TimeBase::LatencyHistogram& h)
+{
+    std::printf("%-28s n=%-8llu min %6llu  p50 %6llu  p99 %7llu  p99.9 %8llu  max %9llu ns\n", name,
+                static_cast<unsigned long long>(h.Count()), static_cast<unsigned long long>(h.MinNs()),
+                static_cast<unsigned long long>(h.QuantileNs(0.50)),
+                static_cast<unsigned long long>(h.QuantileNs(0.99)),
+                static_cast<unsigned long long>(h.QuantileNs(0.999)),
+                static_cast<unsigned long long>(h.MaxNs()));
+}
+
+// Child: echo every VehicleState stamp on the input ring until t < 0 arrives
+int RunEcho(const std::string& name)
+{
+    Bsw::Com::Segment seg;
+    std::string err;
+    if (!seg.Attach(name, err) || !seg.ClaimInput(err)) {
+        std::fprintf(stderr, "com_bench child: %s\n", err.c_str());
+        return 1;
+    }
+    Bsw::Com::Subscriber<Rte::VehicleState> sub(seg->vehicle_state, true);
+    Bsw::Com::Sample<Rte::VehicleState> s;
+    Bsw::TimeBase::LatencyHistogram one_way;
+    for (;;) {
+        if (!sub.Next(s)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const int64_t now = Bsw::Com::NowNs();
+        if (s.value.t < 0.0f) break;
+        one_way.Record(now - s.stamp_ns);
+        seg->input.Publish(Rte::DriverInput{}, s.stamp_ns);
+    }
+    PrintLatency("shm one-way (subscriber)", one_way);
+    if (sub.Lost() != 0) std::printf("  lost %llu\n", static_cast<unsigned long long>(sub.Lost()));
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const long round_trips = Bench::ArgOr(argc, argv, 1, 100000);
+
+    {
+        auto ring = std::make_unique<Bsw::Com::ShmRing<Rte::VehicleState>>();
+        Bsw::Com::Sample<Rte::VehicleState> s;
+        Rte::VehicleState v;
+        uint64_t seq = 0;
+        const auto r = Bench::Measure("publish+read", 1, 0.3, [&] {
+            v.t += 0.01f;
+            ring->Publish(v, 0);
+            ring->Read(seq++, s);
+            Bench::DoNotOptimize(s);
+        });
+        std::printf("%-28s %.1f ns per sample (single thread)\n", "ShmRing publish+read", r.NsPerElement());
+    }
+
+    const std::string name = "/sdv_com_bench_" + std::to_string(::getpid());
+    Bsw::Com::Segment seg;
+    std::string err;
+    if (!seg.Create(name, err)) {
+        std::fprintf(stderr, "com_bench: %s\n", err.c_str());
+        return 1;
+    }
+    std::fflush(stdout);
+    const pid_t child = ::fork();
+    if (child < 0) {
+        std::perror("com_bench: fork");
+        return 1;
+    }
+    if (child == 0) {
+        const int rc = RunEcho(name);
+        std::fflush(stdout);
+        _exit(rc);
+    }
+
+    Bsw::TimeBase::LatencyHistogram rtt;
+    Bsw::Com::Sample<Rte::DriverInput> echo;
+    Rte::VehicleState v;
+    for (long k = 0; k < round_trips; ++k) {
+        v.t = 0.01f * static_cast<float>(k);
+        const int64_t sent = Bsw::Com::NowNs();
+        seg->vehicle_state.Publish(v, sent);
+        while (!seg->input.Read(static_cast<uint64_t>(k), echo)) std::this_thread::yield();
+        rtt.Record(Bsw::Com::NowNs() - echo.stamp_ns);
+    }
+    v.t = -1.0f;
+    seg->vehicle_state.Publish(v);
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    PrintLatency("shm round trip (publisher)", rtt);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : 1;
+}
@@ -0,0 +1,238 @@
+// Microbenchmarks for the Model layer and the SWC runnables, JSON output.
+//
+// usage: model_bench [--json FILE] [--min-time SECONDS]
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "app/ecu.h"
+#include "app/scenario.h"
+#include "bench_util.h"
+#include "model/bicycle_batch.h"
+#include "model/bicycle_simd.h"
+#include "model/brake_model.h"
+#include "model/engine_model.h"
+#include "model/fixed_params.h"
+#include "model/steering_model.h"
+#include "model/vehicledynamics_model.h"
+#include "rte/rte.h"
+
+namespace {
+
+const std::size_t kBatchSizes[] = {1, 64, 1024, 16384};
+
+struct Inputs {
+    std::vector<float> pedal, steer, drive, brake, steer_angle, out;
+    std::vector<uint8_t> estop;
+
+    explicit Inputs(std::size_t n)
+        : pedal(n), steer(n), drive(n), brake(n), steer_angle(n), out(n), estop(n, 0)
+    {
+        for (std::size_t i = 0; i < n; ++i) {
+            const float u = static_cast<float>(i % 101) / 100.0f;
+            pedal[i] = u;
+            steer[i] = 2.0f * u - 1.0f;
+            drive[i] = 2.0f * u;
+            brake[i] = (i % 3 == 0) ? u : 0.0f;
+            steer_angle[i] = 0.4f * steer[i];
+        }
+    }
+};
+
+void BenchModel(std::vector<Bench::Result>& out, double min_s)
+{
+    for (const std::size_t n : kBatchSizes) {
+        Inputs in(n);
+
+        // Runtime variants read their params through memory (as the SWCs do from
+        // Rte::Calibration); ".fixed" uses the compile-time Model::Fixed::*V1 sets.
+        Model::BrakeParams bp{};
+        out.push_back(Bench::Measure("ComputeBrakeDecel", n, min_s, [&] {
+            Bench::DoNotOptimize(bp);
+            for (std::size_t i = 0; i < n; ++i) in.out[i] = Model::ComputeBrakeDecel(in.pedal[i], in.estop[i] != 0, bp);
+            Bench::DoNotOptimize(in.out[n - 1]);
+        }));
+        out.push_back(Bench::Measure("ComputeBrakeDecel.fixed", n, min_s, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                in.out[i] = Model::ComputeBrakeDecel<Model::Fixed::kBrakeV1>(in.pedal[i], in.estop[i] != 0);
+            }
+            Bench::DoNotOptimize(in.out[n - 1]);
+        }));
+
+        Model::EngineParams ep{};
+        out.push_back(Bench::Measure("ComputeDriveAccel", n, min_s, [&] {
+            Bench::DoNotOptimize(ep);
+            for (std::size_t i = 0; i < n; ++i) in.out[i] = Model::ComputeDriveAccel(in.pedal[i], in.estop[i] != 0, ep);
+            Bench::DoNotOptimize(in.out[n - 1]);
+        }));
+        out.push_back(Bench::Measure("ComputeDriveAccel.fixed", n, min_s, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                in.out[i] = Model::ComputeDriveAccel<Model::Fixed::kEngineV1>(in.pedal[i], in.estop[i] != 0);
+            }
+            Bench::DoNotOptimize(in.out[n - 1]);
+        }));
+
+        Model::VehicleParams vp{};
+        std::vector<Model::VehicleState> lon(n);
+        out.push_back(Bench::Measure("StepLongitudinal", n, min_s, [&] {
+            Bench::DoNotOptimize(vp);
+            for (std::size_t i = 0; i < n; ++i) {
+                lon[i] = Model::StepLongitudinal(lon[i], 0.01f, in.drive[i], in.brake[i], in.estop[i] != 0, vp);
+            }
+            Bench::DoNotOptimize(lon[n - 1]);
+        }));
+        std::vector<Model::VehicleState> lon_fixed(n);
+        out.push_back(Bench::Measure("StepLongitudinal.fixed", n, min_s, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                lon_fixed[i] = Model::StepLongitudinal<Model::Fixed::kVehicleV1>(lon_fixed[i], 0.01f, in.drive[i],
+                                                                                  in.brake[i], in.estop[i] != 0);
+            }
+            Bench::DoNotOptimize(lon_fixed[n - 1]);
+        }));
+
+        const Model::SteeringParams sp{};
+        std::vector<float> lag(n, 0.0f);
+        out.push_back(Bench::Measure("SteeringLag", n, min_s, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                const float target = Model::ComputeSteerTarget(in.steer[i], in.estop[i] != 0, sp);
+                in.out[i] = Model::StepSteerLag(lag[i], target, 0.01, sp);
+            }
+            Bench::DoNotOptimize(in.out[n - 1]);
+        }));
+
+        const Model::BicycleParams bip{};
+        std::vector<Model::BicycleState> aos(n);
+        out.push_back(Bench::Measure("StepBicycle", n, min_s, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                Model::StepBicycle(aos[i], 0.01f, in.drive[i], in.brake[i], in.steer_angle[i], in.estop[i] != 0, bip);
+            }
+            Bench::DoNotOptimize(aos[n - 1]);
+        }));
+
+        Model::BicycleBatch soa(n);
+        const Model::BicycleBatchInput bin{in.drive.data(), in.brake.data(), in.steer_angle.data(), in.estop.data()};
+        out.push_back(Bench::Measure("StepBicycleBatch", n, min_s, [&] {
+            Model::StepBicycleBatch(soa, 0.01f, bin, bip);
+            Bench::DoNotOptimize(soa.x[n - 1]);
+        }));
+
+        Model::BicycleBatch fast(n);
+        out.push_back(Bench::Measure("StepBicycleBatchFast", n, min_s, [&] {
+            Model::StepBicycleBatchFast(fast, 0.01f, bin, bip);
+            Bench::DoNotOptimize(fast.x[n - 1]);
+        }));
+    }
+}
+
+void BenchRunnables(std::vector<Bench::Result>& out, double min_s)
+{
+    Rte::Context ctx;
+    App::InitEcu(ctx); // Logging not initialised: Logging::Tick10ms returns at once
+    Rte::DriverInput in{};
+    in.throttle = 0.4f;
+    in.steer = 0.2f;
+    Rte::Rte_Write_DriverInput(ctx, in);
+
+    out.push_back(Bench::Measure("Engine::Main10ms", 1, min_s, [&] {
+        App::Engine_10ms(ctx);
+        Bench::DoNotOptimize(ctx);
+    }));
+    out.push_back(Bench::Measure("Brake::Main10ms", 1, min_s, [&] {
+        App::Brake_10ms(ctx);
+        Bench::DoNotOptimize(ctx);
+    }));
+    out.push_back(Bench::Measure("Steering::Main10ms", 1, min_s, [&] {
+        App::Steering_10ms(ctx);
+        Bench::DoNotOptimize(ctx);
+    }));
+    out.push_back(Bench::Measure("VehicleDynamics::Step10ms", 1, min_s, [&] {
+        App::VehicleDynamics_10ms(ctx);
+        Bench::DoNotOptimize(ctx);
+    }));
+
+    // Full 10ms cycle through the real RTE: the 10ms table plus, amortised,
+    // the 20ms and 100ms tables as the scheduler would run them.
+    App::InitEcu(ctx);
+    uint64_t tick = 0;
+    out.push_back(Bench::Measure("Cycle10ms", 1, min_s, [&] {
+        App::Tasks10ms::Run(ctx);
+        if ((tick % 2) == 0) App::Tasks20ms::Run(ctx);
+        if ((tick % 10) == 0) App::Tasks100ms::Run(ctx);
+        ++tick;
+        Bench::DoNotOptimize(ctx);
+    }));
+}
+
+// Per-tick scenario lookup cost vs table size: should stay flat for 10ms ticks
+void BenchScenario(std::vector<Bench::Result>& out, double min_s)
+{
+    for (const std::size_t n : {std::size_t{16}, std::size_t{1024}, std::size_t{65536}}) {
+        std::ostringstream table;
+        for (std::size_t i = 0; i < n; ++i) {
+            table << i << ' ' << i + 1 << " 0:1 0 " << (i % 2 ? "-0.5:0.5" : "0.1") << '\n';
+        }
+        App::ScenarioSource s;
+        std::string err;
+        if (!s.LoadString(table.str(), err)) {
+            std::fprintf(stderr, "scenario: %s\n", err.c_str());
+            std::exit(1);
+        }
+        const std::string suffix = ".segments" + std::to_string(n);
+
+        float t = 0.0f;
+        const float end = s.EndTime();
+        Rte::DriverInput in{};
+        out.push_back(Bench::Measure("ScenarioSample.monotonic" + suffix, 1, min_s, [&] {
+            t += 0.01f;
+            if (t >= end) t = 0.0f;
+            s.Sample(t, in);
+            Bench::DoNotOptimize(in);
+        }));
+
+        std::mt19937 rng(1);
+        std::vector<float> times(4096);
+        for (auto& x : times) x = std::uniform_real_distribution<float>(0.0f, end)(rng);
+        std::size_t k = 0;
+        out.push_back(Bench::Measure("ScenarioSample.random" + suffix, 1, min_s, [&] {
+            s.Sample(times[k++ & 4095], in);
+            Bench::DoNotOptimize(in);
+        }));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* json_path = nullptr;
+    double min_s = 0.2;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_s = std::strtod(argv[++i], nullptr);
+        } else {
+            std::fprintf(stderr, "usage: model_bench [--json FILE] [--min-time SECONDS]\n");
+            return 2;
+        }
+    }
+
+    std::vector<Bench::Result> results;
+    BenchModel(results, min_s);
+    BenchRunnables(results, min_s);
+    BenchScenario(results, min_s);
+
+    std::FILE* fp = json_path ? std::fopen(json_path, "w") : stdout;
+    if (!fp) {
+        std::perror("Failed to open JSON output");
+        return 1;
+    }
+    Bench::WriteJson(fp, results);
+    if (fp != stdout) std::fclose(fp);
+    return 0;
+}
@@ -0,0 +1,132 @@
+// Vehicle-steps per second: scalar StepBicycle (AoS) vs StepBicycleBatch (SoA),
+// and accuracy vs throughput of the fast-trig kernels (StepBicycleBatchFast)
+// against the libm batch after the same number of steps, and accuracy vs
+// throughput of the plant integrators (Model::IntegratorConfig) at larger steps.
+//
+// usage: plant_bench [vehicles=10000] [steps=1000]
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "bench_util.h"
+#include "model/bicycle_batch.h"
+#include "model/bicycle_simd.h"
+#include "model/integrators.h"
+
+namespace {
+
+// One vehicle over a 10 minute drive with time-varying held commands
+Model::BicycleState DriveOne(double seconds, float dt, const Model::IntegratorConfig& cfg,
+                             const Model::BicycleParams& p)
+{
+    Model::BicycleState s{};
+    const long steps = std::lround(seconds / dt);
+    for (long k = 0; k < steps; ++k) {
+        const double t = static_cast<double>(k) * dt;
+        const float drive = 0.3f + 0.4f * static_cast<float>(std::sin(t / 7.0));
+        const float brake = std::fmod(t, 60.0) > 50.0 ? 1.0f : 0.0f;
+        const float steer = 0.3f * static_cast<float>(std::sin(2.0 * M_PI * t / 20.0));
+        Model::StepBicycle(s, dt, drive, brake, steer, false, p, cfg);
+    }
+    return s;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const auto n = static_cast<std::size_t>(Bench::ArgOr(argc, argv, 1, 10000));
+    const long steps = Bench::ArgOr(argc, argv, 2, 1000);
+    const float dt = 0.01f;
+    const Model::BicycleParams p{};
+
+    std::vector<float> drive(n), brake(n, 0.0f), steer(n);
+    std::vector<uint8_t> estop(n, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        drive[i] = 0.5f + 1.5f * static_cast<float>(i % 97) / 97.0f;
+        steer[i] = -0.3f + 0.6f * static_cast<float>(i % 89) / 89.0f;
+    }
+
+    // Scalar path: one BicycleState per vehicle
+    std::vector<Model::BicycleState> aos(n);
+    auto t0 = Bench::Clock::now();
+    for (long k = 0; k < steps; ++k) {
+        for (std::size_t i = 0; i < n; ++i) {
+            Model::StepBicycle(aos[i], dt, drive[i], brake[i], steer[i], estop[i] != 0, p);
+        }
+    }
+    const double scalar_s = Bench::SecondsSince(t0);
+    Bench::DoNotOptimize(aos.back());
+
+    // Batched path
+    Model::BicycleBatch soa(n);
+    const Model::BicycleBatchInput in{drive.data(), brake.data(), steer.data(), estop.data()};
+    t0 = Bench::Clock::now();
+    for (long k = 0; k < steps; ++k) {
+        Model::StepBicycleBatch(soa, dt, in, p);
+    }
+    const double batch_s = Bench::SecondsSince(t0);
+    Bench::DoNotOptimize(soa.x.back());
+
+    const double vsteps = static_cast<double>(n) * static_cast<double>(steps);
+    std::printf("vehicles=%zu steps=%ld\n", n, steps);
+    std::printf("scalar: %.3f s, %.3e vehicle-steps/s\n", scalar_s, vsteps / scalar_s);
+    std::printf("batch : %.3f s, %.3e vehicle-steps/s (x%.2f)\n", batch_s, vsteps / batch_s, scalar_s / batch_s);
+
+    // Fast-trig kernels, each level up to what this CPU supports
+    std::printf("\nfast-trig kernel (detected: %s), error vs libm batch after %ld steps\n",
+                Model::SimdLevelName(Model::DetectSimdLevel()), steps);
+    std::printf("%-8s %8s %14s %8s %11s %11s\n", "level", "time[s]", "v-steps/s", "speedup", "max|dpos|", "max|dyaw|");
+    for (const auto level : {Model::SimdLevel::Scalar, Model::SimdLevel::Sse2, Model::SimdLevel::Avx2}) {
+        if (level > Model::DetectSimdLevel()) break;
+        Model::BicycleBatch fast(n);
+        t0 = Bench::Clock::now();
+        for (long k = 0; k < steps; ++k) {
+            Model::StepBicycleBatchFast(fast, dt, in, p, level);
+        }
+        const double fast_s = Bench::SecondsSince(t0);
+        Bench::DoNotOptimize(fast.x.back());
+
+        double dpos = 0.0;
+        double dyaw = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            dpos = std::max(dpos, static_cast<double>(std::hypot(fast.x[i] - soa.x[i], fast.y[i] - soa.y[i])));
+            dyaw = std::max(dyaw, static_cast<double>(std::fabs(fast.yaw[i] - soa.yaw[i])));
+        }
+        std::printf("%-8s %8.3f %14.3e %7.2fx %11.3e %11.3e\n", Model::SimdLevelName(level), fast_s,
+                    vsteps / fast_s, batch_s / fast_s, dpos, dyaw);
+    }
+
+    // Plant integrators: position error vs a tight RK45 run at the same step
+    constexpr double kDriveS = 600.0;
+    std::printf("\nplant integrators, %.0f s drive, error vs RK45 (tol 1e-11) at the same step\n", kDriveS);
+    std::printf("%-6s %-6s %4s %11s %14s\n", "dt[s]", "method", "sub", "|dpos|[m]", "sim-hours/s");
+    struct Case {
+        Model::Integrator method;
+        int substeps;
+    };
+    const Case cases[] = {{Model::Integrator::SemiImplicitEuler, 1}, {Model::Integrator::SemiImplicitEuler, 10},
+                          {Model::Integrator::Rk4, 1}, {Model::Integrator::Rk4, 4},
+                          {Model::Integrator::Rk45, 1}};
+    for (const float step : {0.01f, 0.1f, 1.0f}) {
+        Model::IntegratorConfig ref_cfg;
+        ref_cfg.method = Model::Integrator::Rk45;
+        ref_cfg.rtol = 1e-11;
+        ref_cfg.atol = 1e-11;
+        const auto ref = DriveOne(kDriveS, step, ref_cfg, p);
+        for (const auto& c : cases) {
+            Model::IntegratorConfig cfg;
+            cfg.method = c.method;
+            cfg.substeps = c.substeps;
+            t0 = Bench::Clock::now();
+            const auto s = DriveOne(kDriveS, step, cfg, p);
+            const double wall_s = Bench::SecondsSince(t0);
+            std::printf("%-6.2f %-6s %4d %11.3e %14.1f\n", step, Model::IntegratorName(c.method), c.substeps,
+                        std::hypot(static_cast<double>(s.x) - ref.x, static_cast<double>(s.y) - ref.y),
+                        kDriveS / 3600.0 / wall_s);
+        }
+    }
+    return 0;
+}
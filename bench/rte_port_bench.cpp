@@ -0,0 +1,106 @@
+// RTE port throughput under contention: one writer, N readers on one
+// VehicleState port. Compares a mutex-guarded port with the lock-free
+// SeqlockPort (PlainPort is not thread safe and is left out).
+//
+// usage: rte_port_bench [max_readers=4] [millis_per_run=300]
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bench_util.h"
+#include "rte/rte.h"
+#include "rte/rte_port.h"
+
+namespace {
+
+// What a port looked like before the seqlock backend, made thread safe the obvious way
+template <typename T>
+class MutexPort {
+public:
+    T Read() const
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        return value_;
+    }
+    void Write(const T& v)
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        value_ = v;
+    }
+
+private:
+    mutable std::mutex mu_;
+    T value_{};
+};
+
+struct Throughput {
+    double writes_per_s = 0.0;
+    double reads_per_s = 0.0; // summed over all readers
+};
+
+template <typename PortT>
+Throughput Run(int readers, std::chrono::milliseconds duration)
+{
+    PortT port;
+    std::atomic<bool> stop{false};
+    std::vector<uint64_t> reads(static_cast<std::size_t>(readers), 0);
+    uint64_t writes = 0;
+
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readers; ++r) {
+        threads.emplace_back([&, r] {
+            uint64_t n = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                Bench::DoNotOptimize(port.Read());
+                ++n;
+            }
+            reads[static_cast<std::size_t>(r)] = n;
+        });
+    }
+    threads.emplace_back([&] {
+        Rte::VehicleState s{};
+        while (!stop.load(std::memory_order_relaxed)) {
+            s.t += 1.0f;
+            port.Write(s);
+            ++writes;
+        }
+    });
+
+    const auto t0 = Bench::Clock::now();
+    std::this_thread::sleep_for(duration);
+    stop.store(true);
+    for (auto& t : threads) t.join();
+    const double sec = Bench::SecondsSince(t0);
+
+    Throughput out;
+    out.writes_per_s = static_cast<double>(writes) / sec;
+    for (const auto n : reads) out.reads_per_s += static_cast<double>(n);
+    out.reads_per_s /= sec;
+    return out;
+}
+
+void Report(const char* name, int readers, const Throughput& tp)
+{
+    std::printf("%-8s %7d %14.3e %14.3e\n", name, readers, tp.writes_per_s, tp.reads_per_s);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int max_readers = static_cast<int>(Bench::ArgOr(argc, argv, 1, 4));
+    const std::chrono::milliseconds duration(Bench::ArgOr(argc, argv, 2, 300));
+
+    std::printf("hardware threads: %u, payload: VehicleState (%zu bytes)\n",
+                std::thread::hardware_concurrency(), sizeof(Rte::VehicleState));
+    std::printf("%-8s %7s %14s %14s\n", "port", "readers", "writes/s", "reads/s");
+    for (int readers = 1; readers <= max_readers; readers *= 2) {
+        Report("mutex", readers, Run<MutexPort<Rte::VehicleState>>(readers, duration));
+        Report("seqlock", readers, Run<Rte::SeqlockPort<Rte::VehicleState>>(readers, duration));
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Ticks per second: runtime Scheduler (std::function vectors) vs
+// StaticScheduler (compile-time task table, unrolled hyperperiod).
+//
+// usage: scheduler_bench [sim_seconds=20000]
+#include <cstdint>
+#include <cstdio>
+
+#include "app/ecu.h"
+#include "bench_util.h"
+#include "bsw/static_scheduler.h"
+#include "bsw/timebase.h"
+#include "rte/rte.h"
+
+namespace {
+
+// Light tasks: isolate dispatch overhead from runnable cost
+uint64_t g_counter = 0;
+void Light()
+{
+    ++g_counter;
+    Bench::DoNotOptimize(g_counter);
+}
+
+using Light10ms = Bsw::TimeBase::TaskList<&Light, &Light, &Light, &Light, &Light, &Light>;
+using Light20ms = Bsw::TimeBase::TaskList<&Light>;
+using Light100ms = Bsw::TimeBase::TaskList<&Light, &Light>;
+using LightStatic = Bsw::TimeBase::StaticScheduler<Light10ms, Light20ms, Light100ms>;
+
+void Report(const char* name, double seconds, double sim_seconds)
+{
+    const double ticks = sim_seconds / 0.010;
+    std::printf("%-22s %.3f s, %.3e ticks/s\n", name, seconds, ticks / seconds);
+}
+
+// Logging is not initialised -> Logging::Tick10ms is a no-op
+Rte::Context g_ctx;
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const double sim_seconds = static_cast<double>(Bench::ArgOr(argc, argv, 1, 20000));
+
+    {
+        Bsw::TimeBase::Scheduler sched;
+        for (int i = 0; i < 6; ++i) sched.AddTask10ms(Light);
+        sched.AddTask20ms(Light);
+        for (int i = 0; i < 2; ++i) sched.AddTask100ms(Light);
+        const auto t0 = Bench::Clock::now();
+        sched.RunForSeconds(sim_seconds);
+        Report("runtime/light", Bench::SecondsSince(t0), sim_seconds);
+    }
+    {
+        const auto t0 = Bench::Clock::now();
+        LightStatic::RunForSeconds(sim_seconds);
+        Report("static/light", Bench::SecondsSince(t0), sim_seconds);
+    }
+    Bench::DoNotOptimize(g_counter);
+
+    {
+        App::InitEcu(g_ctx);
+        Bsw::TimeBase::Scheduler sched;
+        for (auto fn : {&App::Engine_10ms, &App::Brake_10ms, &App::Steering_10ms,
+                        &App::VehicleDynamics_10ms, &App::Diag_10ms, &App::Logging_10ms, &App::Com_10ms}) {
+            sched.AddTask10ms([fn]{ fn(g_ctx); });
+        }
+        sched.AddTask20ms([]{ App::DriverInput_20ms(g_ctx); });
+        sched.AddTask100ms([]{ App::Safety_100ms(g_ctx); });
+        sched.AddTask100ms([]{ App::Diag_100ms(g_ctx); });
+        const auto t0 = Bench::Clock::now();
+        sched.RunForSeconds(sim_seconds);
+        Report("runtime/ecu", Bench::SecondsSince(t0), sim_seconds);
+    }
+    {
+        App::InitEcu(g_ctx);
+        const auto t0 = Bench::Clock::now();
+        App::StaticScheduler::RunForSeconds(sim_seconds, g_ctx);
+        Report("static/ecu", Bench::SecondsSince(t0), sim_seconds);
+    }
+    Bench::DoNotOptimize(Rte::Rte_Read_VehicleState(g_ctx));
+    return 0;
+}
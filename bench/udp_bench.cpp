@@ -0,0 +1,243 @@
+// UDP gateway throughput and latency on loopback.
+//  1. PDU codec: pack one 10ms cycle (VehicleState, ActuatorCmd, DriverInput)
+//     and decode it again, no socket
+//  2. sustained rate: a sender thread streams DriverInput PDUs to a receiver
+//     draining with recvmmsg, for each PDUs-per-datagram x datagrams-per-
+//     sendmmsg combination. The sender stays at most kWindow datagrams ahead
+//     of the receiver, so the socket buffer never overflows and the rate is
+//     what is delivered, not what is dropped.
+//  3. cross-process ping-pong: a forked child echoes every datagram back
+//     unchanged; it reports the send-to-decode one-way latency it observed,
+//     the parent the round trip. Both block in poll(), so on a single core
+//     the numbers include two wakeups per direction.
+//
+// usage: udp_bench [round_trips=20000] [rate_ms=500]
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "bsw/com.h"
+#include "bsw/profiler.h"
+
+namespace {
+
+constexpr uint64_t kWindow = 128; // datagrams in flight, well inside the 1 MiB receive buffer
+
+void PrintLatency(const char* name, const Bsw::TimeBase::LatencyHistogram& h)
+{
+    std::printf("%-28s n=%-8llu min %6llu  p50 %6llu  p99 %7llu  p99.9 %8llu  max %9llu ns\n", name,
+                static_cast<unsigned long long>(h.Count()), static_cast<unsigned long long>(h.MinNs()),
+                static_cast<unsigned long long>(h.QuantileNs(0.50)),
+                static_cast<unsigned long long>(h.QuantileNs(0.99)),
+                static_cast<unsigned long long>(h.QuantileNs(0.999)),
+                static_cast<unsigned long long>(h.MaxNs()));
+}
+
+void Rate(std::size_t pdus_per_datagram, std::size_t datagrams_per_send, long ms)
+{
+    Bsw::Com::UdpSocket rx;
+    Bsw::Com::UdpSocket tx;
+    std::string err;
+    if (!rx.Open(0, err) || !tx.Open(0, err)) {
+        std::fprintf(stderr, "udp_bench: %s\n", err.c_str());
+        return;
+    }
+    tx.SetPeer(rx.LocalPort());
+
+    std::atomic<uint64_t> received{0};
+    std::atomic<bool> done{false};
+    uint64_t sent = 0;
+    uint64_t send_calls = 0;
+    std::thread sender([&] {
+        Bsw::Com::DatagramBuilder b;
+        Rte::DriverInput in;
+        uint16_t cycle = 0;
+        uint32_t seq = 0;
+        while (!done.load(std::memory_order_relaxed)) {
+            if (sent - received.load(std::memory_order_acquire) + datagrams_per_send > kWindow) {
+                std::this_thread::yield();
+                continue;
+            }
+            b.Clear();
+            for (std::size_t d = 0; d < datagrams_per_send; ++d) {
+                b.StartDatagram();
+                for (std::size_t p = 0; p < pdus_per_datagram; ++p) {
+                    in.throttle = static_cast<float>(cycle & 0xff) / 255.0f;
+                    b.Add(cycle++, in);
+                }
+            }
+            b.Finish(seq, Bsw::Com::NowNs());
+            seq += static_cast<uint32_t>(b.DatagramCount());
+            sent += tx.Send(b);
+        }
+        send_calls = tx.SendCalls();
+    });
+
+    Bsw::Com::PduBatch batch;
+    uint64_t pdus = 0;
+    uint64_t datagrams = 0;
+    uint64_t bad = 0;
+    const auto t0 = Bench::Clock::now();
+    double elapsed = 0.0;
+    while ((elapsed = Bench::SecondsSince(t0)) < static_cast<double>(ms) / 1000.0) {
+        if (!rx.WaitReadable(10)) continue;
+        const std::size_t n = rx.Receive();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (Bsw::Com::DecodeDatagram(rx.RxData(i), rx.RxSize(i), batch)) {
+                pdus += batch.pdus.size();
+            } else {
+                ++bad;
+            }
+        }
+        datagrams += n;
+        received.store(datagrams, std::memory_order_release);
+    }
+    done.store(true);
+    sender.join();
+    // Whatever is still queued was delivered, not lost
+    while (rx.WaitReadable(10)) datagrams += rx.Receive();
+
+    const std::size_t bytes = Bsw::Com::kDatagramHeaderBytes + pdus_per_datagram * (Bsw::Com::kPduHeaderBytes + 12);
+    std::printf("%3zu PDU/dgram %3zu dgram/send  %5zu B  %8.0f dgram/s  %9.0f PDU/s  %5.1f dgram/sendcall  "
+                "%5.1f dgram/recvcall  lost %llu%s\n",
+                pdus_per_datagram, datagrams_per_send, bytes, static_cast<double>(datagrams) / elapsed,
+                static_cast<double>(pdus) / elapsed,
+                send_calls ? static_cast<double>(sent) / static_cast<double>(send_calls) : 0.0,
+                rx.RecvCalls() ? static_cast<double>(datagrams) / static_cast<double>(rx.RecvCalls()) : 0.0,
+                static_cast<unsigned long long>(sent - datagrams), bad ? "  MALFORMED" : "");
+}
+
+// Child: echo every datagram to its sender until an empty one arrives
+int RunEcho(uint16_t port)
+{
+    Bsw::Com::UdpSocket sock;
+    std::string err;
+    if (!sock.Open(port, err)) {
+        std::fprintf(stderr, "udp_bench child: %s\n", err.c_str());
+        return 1;
+    }
+    Bsw::Com::PduBatch batch;
+    Bsw::Com::DatagramBuilder echo;
+    Bsw::TimeBase::LatencyHistogram one_way;
+    for (;;) {
+        if (!sock.WaitReadable(1000)) return 1;
+        const std::size_t n = sock.Receive();
+        const int64_t now = Bsw::Com::NowNs();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!Bsw::Com::DecodeDatagram(sock.RxData(i), sock.RxSize(i), batch)) continue;
+            if (batch.pdus.empty()) {
+                PrintLatency("udp one-way (receiver)", one_way);
+                return 0;
+            }
+            one_way.Record(now - batch.stamp_ns);
+            sock.LearnPeer(sock.RxFrom(i));
+            echo.Clear();
+            for (const auto& e : batch.pdus) echo.Add(e.cycle, e.driver_input);
+            echo.Finish(batch.seq, batch.stamp_ns);
+            sock.Send(echo);
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const long round_trips = Bench::ArgOr(argc, argv, 1, 20000);
+    const long rate_ms = Bench::ArgOr(argc, argv, 2, 500);
+
+    {
+        Bsw::Com::DatagramBuilder b;
+        Bsw::Com::PduBatch batch;
+        Rte::VehicleState st;
+        uint16_t cycle = 0;
+        const auto r = Bench::Measure("pack+decode", 3, 0.3, [&] {
+            st.t += 0.01f;
+            b.Clear();
+            b.Add(cycle, st);
+            b.Add(cycle, Rte::ActuatorCmd{});
+            b.Add(cycle++, Rte::DriverInput{});
+            b.Finish(cycle, 0);
+            Bsw::Com::DecodeDatagram(b.Datagram(0).data(), b.Datagram(0).size(), batch);
+            Bench::DoNotOptimize(batch);
+        });
+        std::printf("%-28s %.1f ns per PDU (%zu B datagram for one 10ms cycle)\n", "PDU pack+decode",
+                    r.NsPerElement(), b.Datagram(0).size());
+    }
+
+    std::printf("sustained loopback rate (%ld ms each, %s):\n", rate_ms,
+                SDV_COM_HAVE_MMSG ? "sendmmsg/recvmmsg" : "sendto/recvfrom");
+    for (const std::size_t pdus : {std::size_t{1}, std::size_t{16}, std::size_t{64}}) {
+        for (const std::size_t per_send : {std::size_t{1}, std::size_t{32}}) Rate(pdus, per_send, rate_ms);
+    }
+
+    Bsw::Com::UdpSocket sock;
+    std::string err;
+    if (!sock.Open(0, err)) {
+        std::fprintf(stderr, "udp_bench: %s\n", err.c_str());
+        return 1;
+    }
+    // Reserve a port for the child: bind, note, release
+    uint16_t echo_port = 0;
+    {
+        Bsw::Com::UdpSocket probe;
+        if (!probe.Open(0, err)) {
+            std::fprintf(stderr, "udp_bench: %s\n", err.c_str());
+            return 1;
+        }
+        echo_port = probe.LocalPort();
+    }
+    std::fflush(stdout);
+    const pid_t child = ::fork();
+    if (child < 0) {
+        std::perror("udp_bench: fork");
+        return 1;
+    }
+    if (child == 0) {
+        const int rc = RunEcho(echo_port);
+        std::fflush(stdout);
+        _exit(rc);
+    }
+    sock.SetPeer(echo_port);
+
+    Bsw::TimeBase::LatencyHistogram rtt;
+    Bsw::Com::DatagramBuilder b;
+    Bsw::Com::PduBatch batch;
+    Rte::DriverInput in;
+    // Round trip k; false if no echo within 100 ms
+    const auto ping = [&](uint32_t k) {
+        b.Clear();
+        b.Add(static_cast<uint16_t>(k), in);
+        b.Finish(k, Bsw::Com::NowNs());
+        sock.Send(b);
+        while (sock.WaitReadable(100)) {
+            const std::size_t n = sock.Receive();
+            for (std::size_t i = 0; i < n; ++i) {
+                if (Bsw::Com::DecodeDatagram(sock.RxData(i), sock.RxSize(i), batch) && batch.seq == k) {
+                    rtt.Record(Bsw::Com::NowNs() - batch.stamp_ns);
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    // The child may still be binding: retry until it answers, then measure from scratch
+    uint32_t seq = 0;
+    while (!ping(seq++)) {}
+    rtt = Bsw::TimeBase::LatencyHistogram();
+    for (long k = 0; k < round_trips; ++k) ping(seq++);
+    b.Clear();
+    b.StartDatagram();
+    b.Finish(0, 0);
+    sock.Send(b);
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    PrintLatency("udp round trip (sender)", rtt);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : 1;
+}
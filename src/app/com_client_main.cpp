@@ -0,0 +1,138 @@
+// Stand-in for an external Com peer (HIL rig, visualisation): attaches to the
+// segment of a running `sdv_sim --com NAME`, optionally injects driver input
+// and prints the vehicle state it subscribes to, with the publish-to-receive
+// latency at the end. Between samples it backs off from yielding to short
+// sleeps, so the latency includes up to kMaxIdleSleep of polling delay.
+//
+// usage: sdv_com_client [--name /sdv_com] [--seconds S] [--drive] [--print-ms MS]
+//   --drive     claim the input ring and drive a fixed profile (throttle, curve, brake)
+//   --print-ms  period of the state printout (0 = silent), default 500
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <signal.h>
+
+#include "app/drive_profile.h"
+#include "bsw/com.h"
+#include "bsw/profiler.h"
+
+namespace {
+
+// Idle polling: yield for kSpinPolls empty polls after the last sample, then
+// sleep 10us, 20us, ... up to kMaxIdleSleep, which bounds the latency it adds
+constexpr int kSpinPolls = 64;
+constexpr auto kMaxIdleSleep = std::chrono::microseconds(200);
+
+bool EcuAlive(const Bsw::Com::Segment& seg)
+{
+    const int32_t pid = seg->header.ecu_pid.load(std::memory_order_acquire);
+    return pid > 0 && ::kill(pid, 0) == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string name = Bsw::Com::kDefaultName;
+    double seconds = 10.0;
+    bool drive = false;
+    int print_ms = 500;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--name") == 0 && i + 1 < argc) {
+            name = argv[++i];
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            seconds = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--drive") == 0) {
+            drive = true;
+        } else if (std::strcmp(argv[i], "--print-ms") == 0 && i + 1 < argc) {
+            print_ms = std::atoi(argv[++i]);
+        } else {
+            std::fprintf(stderr, "usage: sdv_com_client [--name /sdv_com] [--seconds S] [--drive] [--print-ms MS]\n");
+            return 2;
+        }
+    }
+
+    // The ECU may still be starting: retry for a few seconds
+    Bsw::Com::Segment seg;
+    std::string err;
+    const auto t_attach = std::chrono::steady_clock::now();
+    while (!seg.Attach(name, err)) {
+        if (std::chrono::steady_clock::now() - t_attach > std::chrono::seconds(5)) {
+            std::fprintf(stderr, "sdv_com_client: %s\n", err.c_str());
+            return 1;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    if (drive && !seg.ClaimInput(err)) {
+        std::fprintf(stderr, "sdv_com_client: %s\n", err.c_str());
+        return 1;
+    }
+
+    Bsw::Com::Subscriber<Rte::VehicleState> state(seg->vehicle_state);
+    Bsw::Com::Subscriber<Rte::Safety> safety(seg->safety);
+    Bsw::Com::Sample<Rte::VehicleState> s;
+    Bsw::Com::Sample<Rte::Safety> sf;
+    seg->safety.Latest(sf);
+    Bsw::TimeBase::LatencyHistogram latency;
+
+    const auto t0 = std::chrono::steady_clock::now();
+    auto next_input = t0;
+    auto next_print = t0;
+    bool ecu_gone = false;
+    int idle_polls = 0;
+    for (;;) {
+        const auto now = std::chrono::steady_clock::now();
+        const double t = std::chrono::duration<double>(now - t0).count();
+        if (t >= seconds) break;
+
+        if (drive && now >= next_input) {
+            seg->input.Publish(App::DriveProfile(t));
+            next_input += std::chrono::milliseconds(10);
+        }
+        bool got = false;
+        while (state.Next(s)) {
+            latency.Record(Bsw::Com::NowNs() - s.stamp_ns);
+            got = true;
+        }
+        while (safety.Next(sf)) {
+            if (sf.value.estop) std::printf("t=%.2f E-Stop\n", static_cast<double>(s.value.t));
+        }
+        if (got && print_ms > 0 && now >= next_print) {
+            std::printf("t=%7.2f x=%8.3f y=%8.3f yaw=%7.3f v=%6.3f state=%u\n", static_cast<double>(s.value.t),
+                        static_cast<double>(s.value.x), static_cast<double>(s.value.y),
+                        static_cast<double>(s.value.yaw), static_cast<double>(s.value.v),
+                        static_cast<unsigned>(sf.value.system_state));
+            next_print = now + std::chrono::milliseconds(print_ms);
+        }
+        if (got) {
+            idle_polls = 0;
+            continue;
+        }
+        if (!EcuAlive(seg)) {
+            ecu_gone = true;
+            break;
+        }
+        if (++idle_polls <= kSpinPolls) {
+            std::this_thread::yield();
+            continue;
+        }
+        auto idle = std::min<std::chrono::microseconds>(
+            kMaxIdleSleep, std::chrono::microseconds(10 << std::min(idle_polls - kSpinPolls - 1, 6)));
+        if (drive) idle = std::min(idle, std::chrono::duration_cast<std::chrono::microseconds>(next_input - now));
+        if (idle.count() > 0) std::this_thread::sleep_for(idle);
+    }
+
+    std::printf("%s%llu VehicleState samples, %llu lost; latency min %llu ns, p50 %llu ns, p99 %llu ns, max %llu ns\n",
+                ecu_gone ? "ECU exited. " : "", static_cast<unsigned long long>(latency.Count()),
+                static_cast<unsigned long long>(state.Lost()),
+                static_cast<unsigned long long>(latency.MinNs()),
+                static_cast<unsigned long long>(latency.QuantileNs(0.50)),
+                static_cast<unsigned long long>(latency.QuantileNs(0.99)),
+                static_cast<unsigned long long>(latency.MaxNs()));
+    return 0;
+}
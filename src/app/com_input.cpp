@@ -0,0 +1,20 @@
+#include "app/com_input.h"
+
+#include "bsw/com.h"
+#include "rte/rte.h"
+
+namespace App {
+
+bool ComInputSource::Sample(float /*t_s*/, Rte::DriverInput& in)
+{
+    Bsw::Com::Sample<Rte::DriverInput> s;
+    const bool got = transport_ == Transport::Udp ? Bsw::Com::PollUdpInput(s) : Bsw::Com::LatestInput(s);
+    if (!got || Bsw::Com::NowNs() - s.stamp_ns > timeout_ns_) {
+        ++stale_;
+        return false;
+    }
+    in = s.value;
+    return true;
+}
+
+} // namespace App
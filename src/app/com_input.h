@@ -0,0 +1,42 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+#include "swc/driverinput_swc.h"
+
+namespace App {
+
+/**
+ * @brief Feeds Swc::DriverInput from the Com segment's input ring or the UDP gateway
+ *
+ * Sample() takes the newest DriverInput injected by another process
+ * (Bsw::Com::Init or InitUdp must have been called). Over UDP this is also
+ * where the socket is drained, so received input only takes effect at the
+ * 20ms DriverInput boundary. Without an injected sample, or if
+ * the newest is older than the timeout (producer stopped or crashed), it
+ * returns false and the SWC releases the pedals and steering for that period;
+ * fresh samples resume control.
+ */
+class ComInputSource final : public Swc::DriverInput::InputSource {
+public:
+    enum class Transport { Shm, Udp };
+
+    explicit ComInputSource(std::chrono::milliseconds timeout = std::chrono::milliseconds(100),
+                            Transport transport = Transport::Shm)
+        : timeout_ns_(std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count()), transport_(transport)
+    {
+    }
+
+    void SetTransport(Transport transport) { transport_ = transport; }
+
+    bool Sample(float t_s, Rte::DriverInput& in) override;
+
+    uint64_t StalePeriods() const { return stale_; } // periods released for lack of fresh input
+
+private:
+    int64_t timeout_ns_;
+    Transport transport_;
+    uint64_t stale_ = 0;
+};
+
+} // namespace App
@@ -0,0 +1,24 @@
+#pragma once
+#include <cmath>
+
+#include "rte/rte.h"
+
+namespace App {
+
+// Fixed driving profile of the external stand-ins (sdv_com_client, sdv_udp_station):
+// 0-3 s accelerate, 3-6 s curve, 6-8 s brake, then coast
+inline Rte::DriverInput DriveProfile(double t)
+{
+    Rte::DriverInput in;
+    if (t < 3.0) {
+        in.throttle = 0.5f;
+    } else if (t < 6.0) {
+        in.throttle = 0.3f;
+        in.steer = 0.4f * static_cast<float>(std::sin(t - 3.0));
+    } else if (t < 8.0) {
+        in.brake = 0.7f;
+    }
+    return in;
+}
+
+} // namespace App
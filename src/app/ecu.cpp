@@ -0,0 +1,97 @@
+#include "app/ecu.h"
+
+#include <cstdint>
+#include <utility>
+
+namespace App {
+
+void InitSwcs(Rte::Context& ctx)
+{
+    Swc::DriverInput::Init(ctx);
+    Swc::Engine::Init(ctx);
+    Swc::Brake::Init(ctx);
+    Swc::Steering::Init(ctx);
+    Swc::VehicleDynamics::Init(ctx);
+    Swc::Safety::Init(ctx);
+}
+
+void InitEcu(Rte::Context& ctx)
+{
+    Rte::InitDefaults(ctx);
+    Bsw::Diag::Init(ctx);
+    InitSwcs(ctx);
+}
+
+namespace {
+
+// Engine/Brake inputs: DriverInput, Safety, calibration. A skipped activation
+// still counts as alive - the runnable was due and its output is current.
+Bsw::TimeBase::DataTrigger ActuatorTrigger(Rte::Context& ctx, Rte::SupervisedEntity e)
+{
+    Bsw::TimeBase::DataTrigger t;
+    t.inputs = [&ctx] {
+        return uint64_t{Rte::Rte_Seq_DriverInput(ctx)} + Rte::Rte_Seq_Safety(ctx) + Rte::Rte_Seq_Calibration(ctx);
+    };
+    t.on_skip = [&ctx, e] { Bsw::Diag::ReportAlive(ctx, e); };
+    return t;
+}
+
+} // namespace
+
+void RegisterTasks(Bsw::TimeBase::Scheduler& sched, Rte::Context& ctx, Triggering triggering)
+{
+    const bool data = triggering == Triggering::DataReceived;
+#if !SDV_ENABLE_PROFILING
+    // Nothing is measured per runnable: one task per rate calls the TaskList
+    // directly, so only the rate activation goes through a TaskFn
+    if (!data) {
+        sched.AddTask10ms([&ctx]{ Tasks10ms::Run(ctx); }, "Tasks10ms");
+        sched.AddTask20ms([&ctx]{ Tasks20ms::Run(ctx); }, "Tasks20ms");
+        sched.AddTask100ms([&ctx]{ Tasks100ms::Run(ctx); }, "Tasks100ms");
+        return;
+    }
+#endif
+    Tasks10ms::ForEach([&](auto fn, std::size_t i) {
+        Bsw::TimeBase::DataTrigger trigger;
+        if (data && fn == &Engine_10ms) trigger = ActuatorTrigger(ctx, Rte::SupervisedEntity::Engine);
+        if (data && fn == &Brake_10ms) trigger = ActuatorTrigger(ctx, Rte::SupervisedEntity::Brake);
+        sched.AddTask10ms([fn, &ctx]{ fn(ctx); }, kTasks10msNames[i], std::move(trigger));
+    });
+    Tasks20ms::ForEach([&](auto fn, std::size_t i) {
+        sched.AddTask20ms([fn, &ctx]{ fn(ctx); }, kTasks20msNames[i]);
+    });
+    Tasks100ms::ForEach([&](auto fn, std::size_t i) {
+        sched.AddTask100ms([fn, &ctx]{ fn(ctx); }, kTasks100msNames[i]);
+    });
+}
+
+void BuildTaskGraph10ms(Bsw::TimeBase::TaskGraph& graph, Rte::Context& ctx)
+{
+    using Id = Bsw::TimeBase::TaskGraph::NodeId;
+    const Id engine = graph.Add("Engine::Main10ms", [&ctx]{ Engine_10ms(ctx); });
+    const Id brake = graph.Add("Brake::Main10ms", [&ctx]{ Brake_10ms(ctx); });
+    const Id steering = graph.Add("Steering::Main10ms", [&ctx]{ Steering_10ms(ctx); });
+    const Id plant = graph.Add("VehicleDynamics::Step10ms", [&ctx]{ VehicleDynamics_10ms(ctx); },
+                               {engine, brake, steering});
+    graph.Add("Diag::Tick10ms", [&ctx]{ Diag_10ms(ctx); });
+    graph.Add("Logging::Tick10ms", [&ctx]{ Logging_10ms(ctx); }, {plant});
+    graph.Add("Com::Tick10ms", [&ctx]{ Com_10ms(ctx); }, {plant});
+}
+
+void RegisterGraphTasks(Bsw::TimeBase::Scheduler& sched, Bsw::TimeBase::TaskGraph& graph, Rte::Context& ctx)
+{
+    sched.AddTask10ms([&graph]{ graph.Run(); }, "TaskGraph10ms");
+#if SDV_ENABLE_PROFILING
+    Tasks20ms::ForEach([&](auto fn, std::size_t i) {
+        sched.AddTask20ms([fn, &ctx]{ fn(ctx); }, kTasks20msNames[i]);
+    });
+    Tasks100ms::ForEach([&](auto fn, std::size_t i) {
+        sched.AddTask100ms([fn, &ctx]{ fn(ctx); }, kTasks100msNames[i]);
+    });
+#else
+    sched.AddTask20ms([&ctx]{ Tasks20ms::Run(ctx); }, "Tasks20ms");
+    sched.AddTask100ms([&ctx]{ Tasks100ms::Run(ctx); }, "Tasks100ms");
+#endif
+}
+
+} // namespace App
@@ -0,0 +1,90 @@
+#pragma once
+#include <iterator>
+
+#include "bsw/com.h"
+#include "bsw/diag.h"
+#include "bsw/logging.h"
+#include "bsw/static_scheduler.h"
+#include "bsw/task_graph.h"
+#include "bsw/timebase.h"
+#include "rte/rte.h"
+
+#include "swc/brake_swc.h"
+#include "swc/driverinput_swc.h"
+#include "swc/engine_swc.h"
+#include "swc/safety_swc.h"
+#include "swc/steering_swc.h"
+#include "swc/vehicledynamics_swc.h"
+
+// ECU wiring: which runnables run at which rate, in which order.
+//  - 10ms: control + plant + logging + Com publication
+//  - 20ms: driver input
+//  - 100ms: safety + diag
+namespace App {
+
+constexpr double kDt10ms = 0.010;
+constexpr double kDt20ms = 0.020;
+constexpr double kDt100ms = 0.100;
+
+// Runnable entry points with the rate baked in (usable as compile-time task table entries).
+// Every runnable works on the ECU instance it is given.
+inline void Engine_10ms(Rte::Context& ctx)          { Swc::Engine::Main10ms(ctx, kDt10ms); }
+inline void Brake_10ms(Rte::Context& ctx)           { Swc::Brake::Main10ms(ctx, kDt10ms); }
+inline void Steering_10ms(Rte::Context& ctx)        { Swc::Steering::Main10ms(ctx, kDt10ms); }
+inline void VehicleDynamics_10ms(Rte::Context& ctx) { Swc::VehicleDynamics::Step10ms(ctx, kDt10ms); }
+inline void Diag_10ms(Rte::Context& /*ctx*/)        { Bsw::Diag::Tick10ms(); }
+inline void Logging_10ms(Rte::Context& ctx)         { Bsw::Logging::Tick10ms(ctx); }
+inline void Com_10ms(Rte::Context& ctx)             { Bsw::Com::Tick10ms(ctx); }
+inline void DriverInput_20ms(Rte::Context& ctx)     { Swc::DriverInput::Main20ms(ctx, kDt20ms); }
+inline void Safety_100ms(Rte::Context& ctx)         { Swc::Safety::Main100ms(ctx, kDt100ms); }
+inline void Diag_100ms(Rte::Context& /*ctx*/)       { Bsw::Diag::Tick100ms(); }
+
+using Tasks10ms = Bsw::TimeBase::TaskList<
+    &Engine_10ms, &Brake_10ms, &Steering_10ms, &VehicleDynamics_10ms, &Diag_10ms, &Logging_10ms, &Com_10ms>;
+using Tasks20ms = Bsw::TimeBase::TaskList<&DriverInput_20ms>;
+using Tasks100ms = Bsw::TimeBase::TaskList<&Safety_100ms, &Diag_100ms>;
+
+// Runnable names for reports (same order as the task lists)
+constexpr const char* kTasks10msNames[] = {
+    "Engine::Main10ms", "Brake::Main10ms", "Steering::Main10ms",
+    "VehicleDynamics::Step10ms", "Diag::Tick10ms", "Logging::Tick10ms", "Com::Tick10ms"};
+constexpr const char* kTasks20msNames[] = {"DriverInput::Main20ms"};
+constexpr const char* kTasks100msNames[] = {"Safety::Main100ms", "Diag::Tick100ms"};
+
+static_assert(std::size(kTasks10msNames) == Tasks10ms::kSize, "10ms names out of sync");
+static_assert(std::size(kTasks20msNames) == Tasks20ms::kSize, "20ms names out of sync");
+static_assert(std::size(kTasks100msNames) == Tasks100ms::kSize, "100ms names out of sync");
+
+// Compile-time task table for production runs: StaticScheduler::RunForSeconds(seconds, ctx)
+using StaticScheduler = Bsw::TimeBase::StaticScheduler<Tasks10ms, Tasks20ms, Tasks100ms>;
+
+// Init all SWCs (RTE and BSW services are initialised by the caller)
+void InitSwcs(Rte::Context& ctx);
+
+// Reset the RTE instance, Diag state and all SWCs of one ECU instance
+void InitEcu(Rte::Context& ctx);
+
+// 10ms runnables as a data-flow graph: Engine, Brake and Steering each own one
+// ActuatorCmd element and run concurrently; VehicleDynamics joins on all three,
+// Logging and Com on VehicleDynamics.
+void BuildTaskGraph10ms(Bsw::TimeBase::TaskGraph& graph, Rte::Context& ctx);
+
+// Like RegisterTasks, but the 10ms rate runs graph (built with BuildTaskGraph10ms)
+void RegisterGraphTasks(Bsw::TimeBase::Scheduler& sched, Bsw::TimeBase::TaskGraph& graph, Rte::Context& ctx);
+
+// How RegisterTasks activates the runnables
+enum class Triggering {
+    Periodic,     // every runnable runs at every activation of its rate (v1)
+    DataReceived, // Engine/Brake (pure functions of DriverInput, Safety and their
+                  // calibration) run only when one of those was updated
+};
+
+// Registers the same task table on a runtime scheduler (ctx must outlive sched).
+// With SDV_ENABLE_PROFILING, or with DataReceived triggering, there is one named
+// task per runnable; otherwise one task per rate runs its TaskList directly.
+// Both triggering modes give identical outputs; Scheduler::Triggers() reports
+// how many invocations DataReceived skipped.
+void RegisterTasks(Bsw::TimeBase::Scheduler& sched, Rte::Context& ctx,
+                   Triggering triggering = Triggering::Periodic);
+
+} // namespace App
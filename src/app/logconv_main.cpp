@@ -0,0 +1,26 @@
+// Converts a columnar or compressed log (sdv_sim --log-format columnar|compressed)
+// back to the CSV that --log-format csv writes.
+//
+// usage: sdv_logconv IN.sdvlog|IN.sdvz OUT.csv
+#include <cstdio>
+#include <string>
+
+#include "bsw/compressed_log.h"
+#include "bsw/logging.h"
+
+int main(int argc, char** argv)
+{
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s IN.sdvlog|IN.sdvz OUT.csv\n", argv[0]);
+        return 2;
+    }
+    std::string err;
+    const bool ok = Bsw::CompressedLog::IsCompressedLog(argv[1])
+        ? Bsw::Logging::CompressedToCsv(argv[1], argv[2], err)
+        : Bsw::Logging::ColumnarToCsv(argv[1], argv[2], err);
+    if (!ok) {
+        std::fprintf(stderr, "sdv_logconv: %s\n", err.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -1,76 +1,338 @@
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <string>
 
-#include "bsw/timebase.h"
+#include "app/com_input.h"
+#include "app/ecu.h"
+#include "app/replay.h"
+#include "app/scenario.h"
+#include "bsw/calib_store.h"
 #include "bsw/logging.h"
-#include "bsw/diag.h"
+#include "bsw/timebase.h"
 #include "rte/rte.h"
 
-#include "swc/driverinput_swc.h"
-#include "swc/engine_swc.h"
-#include "swc/brake_swc.h"
-#include "swc/steering_swc.h"
-#include "swc/vehicledynamics_swc.h"
-#include "swc/safety_swc.h"
-
 static void ensure_logs_dir()
 {
     std::filesystem::create_directories("logs");
 }
 
-int main()
+int main(int argc, char** argv)
 {
     ensure_logs_dir();
 
-    // Init RTE default values
-    Rte_InitDefaults();
-
-    // Init services
-    Bsw::Diag::Init();
-    Bsw::Logging::Init("logs/latest.csv");
-
-    // Init SWCs (if needed)
-    Swc::DriverInput::Init();
-    Swc::Engine::Init();
-    Swc::Brake::Init();
-    Swc::Steering::Init();
-    Swc::VehicleDynamics::Init();
-    Swc::Safety::Init();
+    // --async-log: format/flush the CSV on a background writer thread
+    // --static-sched: run the compile-time task table instead of the runtime scheduler
+    //                 (unpaced, periodic, single thread: not with --realtime, --parallel, --calib,
+    //                 --threads, --triggers data, --com or --udp)
+    // --realtime FACTOR: pace ticks on the wall clock (1 = real time, 0 = as fast as possible)
+    // --parallel N: run independent 10ms runnables concurrently on N extra worker threads
+    // --log-format csv|columnar|compressed: columnar writes logs/latest.sdvlog, compressed
+    //                     logs/latest.sdvz (delta/varint blocks for soak runs); convert with sdv_logconv
+    // --replay FILE: drive with throttle/brake/steer recorded in FILE (CSV, columnar or compressed log)
+    // --scenario FILE: drive with a piecewise scenario table (see app/scenario.h); not with --replay
+    // --seconds S: simulated duration (default 10)
+    // --flight-recorder PRE:POST: keep samples in RAM, write PRE s before / POST s after each
+    //                             E-Stop or fault to logs/latest_NNN.* (nothing else hits the disk)
+    // --calib FILE: calibration overrides ("name = value", see calibration/v1_default.calib);
+    //               the file is watched and changes are applied between ticks
+    // --integrator euler|rk4|rk45, --substeps N: plant integrator (default: euler, 1 sub-step)
+    // --threads det|free: one worker thread per rate (10/20/100ms); det keeps the single-thread
+    //                     order (identical log), free releases each rate on the wall clock
+    //                     (needs an SDV_RTE_SEQLOCK_PORTS build, paced by --realtime, default 1)
+    // --affinity C10,C20,C100 / --fifo P10,P20,P100: per-rate CPU and SCHED_FIFO priority
+    //                     (-1 / 0 = leave as is), with --threads
+    // --triggers periodic|data: data = Engine/Brake run only when their inputs were updated
+    //                     (AUTOSAR DataReceivedEvent); prints the skipped invocations.
+    //                     Not with --parallel (the task graph runs every node each tick)
+    // --com NAME: share DriverInput/ActuatorCmd/VehicleState/Safety in POSIX shared memory NAME
+    //             (e.g. /sdv_com, see bsw/com.h); driver input then comes from the process that
+    //             injects it (sdv_com_client) unless --replay/--scenario is given. Paced in real
+    //             time unless --realtime says otherwise
+    // --udp PORT[:PEER]: UDP signal gateway on 127.0.0.1:PORT (see bsw/com_udp.h); signals go to
+    //             127.0.0.1:PEER, or without PEER to the sender of the newest accepted driver input
+    //             (sdv_udp_station). Driver input then comes over UDP, applied at the 20ms DriverInput boundary;
+    //             paced like --com. --udp-batch N packs N 10ms cycles per send (default 1)
+    auto log_mode = Bsw::Logging::Mode::Sync;
+    auto log_format = Bsw::Logging::Format::Csv;
+    bool static_sched = false;
+    bool paced = false;
+    unsigned parallel_workers = 0;
+    const char* replay_path = nullptr;
+    const char* scenario_path = nullptr;
+    const char* calib_path = nullptr;
+    double sim_seconds = 10.0;
+    Model::IntegratorConfig integrator{};
+    Bsw::Logging::FlightRecorderConfig flight;
+    bool flight_recorder = false;
+    Bsw::TimeBase::PacingConfig pacing;
+    bool threaded = false;
+    auto triggering = App::Triggering::Periodic;
+    Bsw::TimeBase::ThreadedConfig threads;
+    const char* com_name = nullptr;
+    bool use_udp = false;
+    Bsw::Com::UdpConfig udp;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--async-log") == 0) {
+            log_mode = Bsw::Logging::Mode::Async;
+        } else if (std::strcmp(argv[i], "--static-sched") == 0) {
+            static_sched = true;
+        } else if (std::strcmp(argv[i], "--realtime") == 0 && i + 1 < argc) {
+            paced = true;
+            pacing.speed_factor = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--parallel") == 0 && i + 1 < argc) {
+            parallel_workers = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            scenario_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            sim_seconds = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--flight-recorder") == 0 && i + 1 < argc) {
+            flight_recorder = true;
+            if (std::sscanf(argv[++i], "%lf:%lf", &flight.pre_s, &flight.post_s) != 2) {
+                std::fprintf(stderr, "sdv_sim: --flight-recorder expects PRE:POST seconds\n");
+                return 2;
+            }
+        } else if (std::strcmp(argv[i], "--calib") == 0 && i + 1 < argc) {
+            calib_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--integrator") == 0 && i + 1 < argc) {
+            if (!Model::ParseIntegrator(argv[++i], integrator.method)) {
+                std::fprintf(stderr, "sdv_sim: unknown integrator '%s' (euler|rk4|rk45)\n", argv[i]);
+                return 2;
+            }
+        } else if (std::strcmp(argv[i], "--substeps") == 0 && i + 1 < argc) {
+            integrator.substeps = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threaded = true;
+            ++i;
+            if (std::strcmp(argv[i], "det") != 0 && std::strcmp(argv[i], "free") != 0) {
+                std::fprintf(stderr, "sdv_sim: unknown --threads mode '%s' (det|free)\n", argv[i]);
+                return 2;
+            }
+            threads.deterministic = std::strcmp(argv[i], "det") == 0;
+        } else if (std::strcmp(argv[i], "--triggers") == 0 && i + 1 < argc) {
+            ++i;
+            if (std::strcmp(argv[i], "periodic") != 0 && std::strcmp(argv[i], "data") != 0) {
+                std::fprintf(stderr, "sdv_sim: unknown --triggers mode '%s' (periodic|data)\n", argv[i]);
+                return 2;
+            }
+            triggering = std::strcmp(argv[i], "data") == 0 ? App::Triggering::DataReceived
+                                                           : App::Triggering::Periodic;
+        } else if (std::strcmp(argv[i], "--affinity") == 0 && i + 1 < argc) {
+            auto& r = threads.rates;
+            if (std::sscanf(argv[++i], "%d,%d,%d", &r[0].cpu, &r[1].cpu, &r[2].cpu) != 3) {
+                std::fprintf(stderr, "sdv_sim: --affinity expects C10,C20,C100\n");
+                return 2;
+            }
+        } else if (std::strcmp(argv[i], "--fifo") == 0 && i + 1 < argc) {
+            auto& r = threads.rates;
+            if (std::sscanf(argv[++i], "%d,%d,%d", &r[0].fifo_priority, &r[1].fifo_priority,
+                            &r[2].fifo_priority) != 3) {
+                std::fprintf(stderr, "sdv_sim: --fifo expects P10,P20,P100\n");
+                return 2;
+            }
+        } else if (std::strcmp(argv[i], "--com") == 0 && i + 1 < argc) {
+            com_name = argv[++i];
+        } else if (std::strcmp(argv[i], "--udp") == 0 && i + 1 < argc) {
+            unsigned port = 0;
+            unsigned peer = 0;
+            if (std::sscanf(argv[++i], "%u:%u", &port, &peer) < 1 || port > 65535 || peer > 65535) {
+                std::fprintf(stderr, "sdv_sim: --udp expects PORT or PORT:PEER\n");
+                return 2;
+            }
+            use_udp = true;
+            udp.bind_port = static_cast<uint16_t>(port);
+            udp.peer_port = static_cast<uint16_t>(peer);
+        } else if (std::strcmp(argv[i], "--udp-batch") == 0 && i + 1 < argc) {
+            const long n = std::strtol(argv[++i], nullptr, 10);
+            udp.batch_cycles = n > 0 ? static_cast<uint32_t>(n) : 1u;
+        } else if (std::strcmp(argv[i], "--log-format") == 0 && i + 1 < argc) {
+            ++i;
+            if (std::strcmp(argv[i], "csv") == 0) {
+                log_format = Bsw::Logging::Format::Csv;
+            } else if (std::strcmp(argv[i], "columnar") == 0) {
+                log_format = Bsw::Logging::Format::Columnar;
+            } else if (std::strcmp(argv[i], "compressed") == 0) {
+                log_format = Bsw::Logging::Format::Compressed;
+            } else {
+                std::fprintf(stderr, "sdv_sim: unknown --log-format '%s' (csv|columnar|compressed)\n", argv[i]);
+                return 2;
+            }
+        }
+    }
 
-    // Fixed-step scheduler (v1 skeleton)
-    //  - 10ms: control + plant + logging
-    //  - 20ms: driver input
-    //  - 100ms: safety + diag
-    Bsw::TimeBase::Scheduler sched;
+    if (replay_path && scenario_path) {
+        std::fprintf(stderr, "sdv_sim: --replay and --scenario would both drive the input; use one\n");
+        return 2;
+    }
+    if (triggering == App::Triggering::DataReceived && parallel_workers > 0) {
+        std::fprintf(stderr, "sdv_sim: --triggers data cannot be combined with --parallel "
+                             "(the task graph is periodic)\n");
+        return 2;
+    }
+    if (com_name && use_udp) {
+        std::fprintf(stderr, "sdv_sim: --com and --udp would both inject driver input; use one\n");
+        return 2;
+    }
+    if (static_sched) {
+        // The static table has no pacing, hooks, workers or triggers: refuse rather than ignore it
+        const char* conflict = paced                                         ? "--realtime"
+                               : parallel_workers > 0                        ? "--parallel"
+                               : calib_path                                  ? "--calib"
+                               : threaded                                    ? "--threads"
+                               : triggering == App::Triggering::DataReceived ? "--triggers data"
+                               : com_name                                    ? "--com"
+                               : use_udp                                     ? "--udp"
+                                                                             : nullptr;
+        if (conflict) {
+            std::fprintf(stderr, "sdv_sim: --static-sched runs the fixed task table and cannot be combined with %s\n",
+                         conflict);
+            return 2;
+        }
+    }
+    if ((com_name || use_udp) && !paced) {
+        // External processes exchange data with the ECU on the wall clock
+        paced = true;
+        pacing.speed_factor = 1.0;
+    }
+    if (threaded && !threads.deterministic) {
+        // Rates run concurrently: ports must be seqlocks, and the calibration
+        // swap between ticks would race with the 20/100ms threads
+        if (!Rte::kThreadSafePorts) {
+            std::fprintf(stderr, "sdv_sim: --threads free needs a build with SDV_RTE_SEQLOCK_PORTS=ON\n");
+            return 2;
+        }
+        if (calib_path) {
+            std::fprintf(stderr, "sdv_sim: --threads free cannot be combined with --calib\n");
+            return 2;
+        }
+        threads.speed_factor = paced ? pacing.speed_factor : 1.0;
+    } else if (threaded && paced) {
+        threads.speed_factor = pacing.speed_factor;
+    }
 
-    constexpr double dt10 = 0.010;
-    constexpr double dt20 = 0.020;
+    // Default ECU instance: RTE default values, Diag, SWCs
+    Rte::Context& ctx = Rte::DefaultContext();
+    ctx.calib.plant_integrator = integrator;
+    Bsw::Calib::Store calib;
+    if (calib_path) {
+        std::string err;
+        if (!calib.Open(calib_path, ctx.calib, err)) {
+            std::fprintf(stderr, "sdv_sim: %s\n", err.c_str());
+            return 1;
+        }
+        calib.Apply(ctx);
+        calib.StartWatcher(std::chrono::milliseconds(200));
+    }
+    App::InitEcu(ctx);
 
-    sched.AddTask10ms([&]{
-        Swc::Engine::Main10ms(dt10);
-        Swc::Brake::Main10ms(dt10);
-        Swc::Steering::Main10ms(dt10);
-        Swc::VehicleDynamics::Step10ms(dt10);
+    App::ReplaySource replay;
+    if (replay_path) {
+        std::string err;
+        if (!replay.Open(replay_path, err)) {
+            std::fprintf(stderr, "sdv_sim: %s\n", err.c_str());
+            return 1;
+        }
+        Swc::DriverInput::SetSource(ctx, &replay);
+    }
+    App::ScenarioSource scenario;
+    if (scenario_path) {
+        std::string err;
+        if (!scenario.LoadFile(scenario_path, err)) {
+            std::fprintf(stderr, "sdv_sim: %s\n", err.c_str());
+            return 1;
+        }
+        Swc::DriverInput::SetSource(ctx, &scenario);
+    }
+    App::ComInputSource com_input;
+    if (com_name) {
+        std::string err;
+        if (!Bsw::Com::Init(com_name, err)) {
+            std::fprintf(stderr, "sdv_sim: %s\n", err.c_str());
+            return 1;
+        }
+        if (!replay_path && !scenario_path) Swc::DriverInput::SetSource(ctx, &com_input);
+    }
+    if (use_udp) {
+        std::string err;
+        if (!Bsw::Com::InitUdp(udp, err)) {
+            std::fprintf(stderr, "sdv_sim: %s\n", err.c_str());
+            return 1;
+        }
+        std::printf("UDP gateway on 127.0.0.1:%u\n", static_cast<unsigned>(Bsw::Com::UdpLocalPort()));
+        com_input.SetTransport(App::ComInputSource::Transport::Udp);
+        if (!replay_path && !scenario_path) Swc::DriverInput::SetSource(ctx, &com_input);
+    }
 
-        Bsw::Diag::Tick10ms();
-        Bsw::Logging::Tick10ms();
-    });
-
-    sched.AddTask20ms([&]{
-        Swc::DriverInput::Main20ms(dt20);
-    });
+    // Init services
+    const char* log_path = log_format == Bsw::Logging::Format::Columnar     ? "logs/latest.sdvlog"
+                           : log_format == Bsw::Logging::Format::Compressed ? "logs/latest.sdvz"
+                                                                            : "logs/latest.csv";
+    if (flight_recorder) {
+        Bsw::Logging::InitFlightRecorder(log_path, flight, log_format);
+    } else {
+        Bsw::Logging::Init(log_path, log_mode, log_format);
+    }
 
-    sched.AddTask100ms([&]{
-        Swc::Safety::Main100ms(0.100);
-        Bsw::Diag::Tick100ms();
-    });
+    // Run a short demo loop (10 seconds by default) so the repo "does something" out of the box.
+    // Input is the built-in scenario unless --replay, --scenario, --com or --udp is given.
+    const bool data_triggers = triggering == App::Triggering::DataReceived;
+    if (static_sched) {
+        App::StaticScheduler::RunForSeconds(sim_seconds, ctx);
+    } else {
+        // Fixed-step scheduler (v1 skeleton), task table from app/ecu.h
+        Bsw::TimeBase::Scheduler sched;
+        Bsw::TimeBase::TaskGraph graph(parallel_workers);
+        if (calib_path) sched.SetTickPrologue([&] { calib.Apply(ctx); });
+        if (parallel_workers > 0) {
+            App::BuildTaskGraph10ms(graph, ctx);
+            App::RegisterGraphTasks(sched, graph, ctx);
+        } else {
+            App::RegisterTasks(sched, ctx, triggering);
+        }
+        if (threaded) {
+            sched.RunThreaded(sim_seconds, threads);
+        } else if (paced) {
+            sched.RunPaced(sim_seconds, pacing);
+        } else {
+            sched.RunForSeconds(sim_seconds);
+        }
+        if (data_triggers) sched.PrintTriggerReport();
+    }
 
-    // Run a short demo loop (10 seconds) so the repo "does something" out of the box.
-    // Input is a simple built-in scenario for now; later replace with Com/UI.
-    constexpr double sim_seconds = 10.0;
-    sched.RunForSeconds(sim_seconds);
+    calib.StopWatcher();
+    Bsw::Logging::Shutdown();
+    if (com_name) {
+        const auto com = Bsw::Com::GetStats();
+        std::printf("Com %s: %llu samples published, %llu driver inputs received, %llu periods without input\n",
+                    com_name, static_cast<unsigned long long>(com.published),
+                    static_cast<unsigned long long>(com.input_samples),
+                    static_cast<unsigned long long>(com_input.StalePeriods()));
+        Bsw::Com::Shutdown();
+    }
+    if (use_udp) {
+        const auto u = Bsw::Com::GetUdpStats();
+        std::printf("UDP: %llu PDUs in %llu datagrams sent (%llu send calls, %llu dropped), %llu driver inputs "
+                    "received (%llu stale, %llu malformed datagrams), %llu periods without input\n",
+                    static_cast<unsigned long long>(u.pdus_tx), static_cast<unsigned long long>(u.datagrams_tx),
+                    static_cast<unsigned long long>(u.send_calls), static_cast<unsigned long long>(u.send_dropped),
+                    static_cast<unsigned long long>(u.inputs), static_cast<unsigned long long>(u.stale_inputs),
+                    static_cast<unsigned long long>(u.malformed),
+                    static_cast<unsigned long long>(com_input.StalePeriods()));
+        Bsw::Com::Shutdown();
+    }
 
-    std::printf("Done. Log written to logs/latest.csv\n");
+    if (flight_recorder) {
+        const auto log_stats = Bsw::Logging::GetStats();
+        std::printf("Done. Flight recorder wrote %llu window(s), %llu failed\n",
+                    static_cast<unsigned long long>(log_stats.dumps),
+                    static_cast<unsigned long long>(log_stats.dump_failures));
+    } else {
+        std::printf("Done. Log written to %s\n", log_path);
+    }
     return 0;
 }
@@ -0,0 +1,275 @@
+#include "app/replay.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "bsw/columnar_log.h"
+#include "bsw/compressed_log.h"
+#include "rte/rte.h"
+
+namespace App {
+
+// Pulls rows from either log format, one at a time, in constant memory
+class ReplaySource::Parser {
+public:
+    virtual ~Parser() = default;
+    virtual bool Next(Row& out) = 0;
+};
+
+namespace {
+
+// The CSV prints t with %.3f; anything closer than half of that is the same instant
+constexpr float kTimeEpsilon = 0.0005f;
+
+constexpr const char* kReplayColumns[] = {"t", "throttle", "brake", "steer"};
+
+using Row = ReplaySource::Row;
+
+class CsvParser final : public ReplaySource::Parser {
+public:
+    ~CsvParser() override
+    {
+        if (fp_) std::fclose(fp_);
+    }
+
+    bool Open(const std::string& path, std::string& err)
+    {
+        fp_ = std::fopen(path.c_str(), "r");
+        if (!fp_) {
+            err = "cannot open " + path;
+            return false;
+        }
+        std::setvbuf(fp_, nullptr, _IOFBF, 1 << 16);
+        if (!std::fgets(line_, sizeof(line_), fp_)) {
+            err = path + ": empty file";
+            return false;
+        }
+        // Map header names to field indices
+        int field = 0;
+        for (char* tok = std::strtok(line_, ",\r\n"); tok; tok = std::strtok(nullptr, ",\r\n"), ++field) {
+            for (std::size_t c = 0; c < 4; ++c) {
+                if (std::strcmp(tok, kReplayColumns[c]) == 0) index_[c] = field;
+            }
+        }
+        for (std::size_t c = 0; c < 4; ++c) {
+            if (index_[c] < 0) {
+                err = path + ": missing column '" + kReplayColumns[c] + "'";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Next(Row& out) override
+    {
+        float values[4] = {};
+        int found = 0;
+        while (found < 4) {
+            if (!std::fgets(line_, sizeof(line_), fp_)) return false;
+            found = 0;
+            int field = 0;
+            for (char* p = line_; *p != '\0' && *p != '\n'; ++field) {
+                char* end = p;
+                const float v = std::strtof(p, &end);
+                for (std::size_t c = 0; c < 4; ++c) {
+                    if (index_[c] == field && end != p) {
+                        values[c] = v;
+                        ++found;
+                    }
+                }
+                p = std::strchr(p, ',');
+                if (!p) break;
+                ++p;
+            }
+            // Rows with missing fields (e.g. a torn last line) are skipped
+        }
+        out = Row{values[0], values[1], values[2], values[3]};
+        return true;
+    }
+
+private:
+    std::FILE* fp_ = nullptr;
+    char line_[1024];
+    int index_[4] = {-1, -1, -1, -1};
+};
+
+class ColumnarParser final : public ReplaySource::Parser {
+public:
+    bool Open(const std::string& path, std::string& err)
+    {
+        if (!reader_.Open(path, err)) return false;
+        for (std::size_t c = 0; c < 4; ++c) {
+            index_[c] = reader_.FindColumn(kReplayColumns[c]);
+            if (index_[c] < 0 || reader_.Column(static_cast<std::size_t>(index_[c])).type !=
+                                     Bsw::ColumnarLog::ColumnType::F32) {
+                err = path + ": missing or mistyped column '" + kReplayColumns[c] + "'";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Next(Row& out) override
+    {
+        while (row_ >= reader_.Rows()) {
+            if (!reader_.NextChunk()) return false;
+            row_ = 0;
+            for (std::size_t c = 0; c < 4; ++c) {
+                cols_[c] = reader_.ColumnSpan<float>(static_cast<std::size_t>(index_[c]));
+            }
+        }
+        out = Row{cols_[0][row_], cols_[1][row_], cols_[2][row_], cols_[3][row_]};
+        ++row_;
+        return true;
+    }
+
+private:
+    Bsw::ColumnarLog::StreamReader reader_;
+    int index_[4] = {-1, -1, -1, -1};
+    Bsw::ColumnarLog::Span<float> cols_[4];
+    std::size_t row_ = 0;
+};
+
+class CompressedParser final : public ReplaySource::Parser {
+public:
+    bool Open(const std::string& path, std::string& err)
+    {
+        if (!reader_.Open(path, err)) return false;
+        for (std::size_t c = 0; c < 4; ++c) {
+            index_[c] = reader_.FindColumn(kReplayColumns[c]);
+            if (index_[c] < 0 || reader_.Column(static_cast<std::size_t>(index_[c])).type !=
+                                     Bsw::ColumnarLog::ColumnType::F32) {
+                err = path + ": missing or mistyped column '" + kReplayColumns[c] + "'";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Next(Row& out) override
+    {
+        while (row_ >= reader_.Rows()) {
+            if (!reader_.NextBlock()) return false;
+            row_ = 0;
+            for (std::size_t c = 0; c < 4; ++c) {
+                cols_[c] = reader_.Values(static_cast<std::size_t>(index_[c]));
+            }
+        }
+        out = Row{cols_[0][row_], cols_[1][row_], cols_[2][row_], cols_[3][row_]};
+        ++row_;
+        return true;
+    }
+
+private:
+    Bsw::CompressedLog::StreamReader reader_;
+    int index_[4] = {-1, -1, -1, -1};
+    Bsw::ColumnarLog::Span<float> cols_[4];
+    std::size_t row_ = 0;
+};
+
+} // namespace
+
+ReplaySource::ReplaySource(std::size_t prefetch_samples)
+{
+    std::size_t n = 1;
+    while (n < prefetch_samples) n <<= 1;
+    ring_.resize(n);
+    mask_ = n - 1;
+}
+
+ReplaySource::~ReplaySource() { Close(); }
+
+bool ReplaySource::Open(const std::string& path, std::string& err)
+{
+    Close();
+    if (Bsw::ColumnarLog::IsColumnarLog(path)) {
+        auto p = std::make_unique<ColumnarParser>();
+        if (!p->Open(path, err)) return false;
+        parser_ = std::move(p);
+    } else if (Bsw::CompressedLog::IsCompressedLog(path)) {
+        auto p = std::make_unique<CompressedParser>();
+        if (!p->Open(path, err)) return false;
+        parser_ = std::move(p);
+    } else {
+        auto p = std::make_unique<CsvParser>();
+        if (!p->Open(path, err)) return false;
+        parser_ = std::move(p);
+    }
+    head_.store(0);
+    tail_.store(0);
+    eof_.store(false);
+    stop_.store(false);
+    have_next_ = false;
+    exhausted_ = false;
+    consumed_ = 0;
+    producer_ = std::thread([this] { ProducerMain(); });
+    return true;
+}
+
+void ReplaySource::Close()
+{
+    if (producer_.joinable()) {
+        stop_.store(true, std::memory_order_release);
+        producer_.join();
+    }
+    parser_.reset();
+}
+
+void ReplaySource::ProducerMain()
+{
+    Row row;
+    while (parser_->Next(row)) {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        // Ring full: wait for the simulation to consume (never drop, never grow)
+        while (head - tail_.load(std::memory_order_acquire) >= ring_.size()) {
+            if (stop_.load(std::memory_order_acquire)) return;
+            std::this_thread::yield();
+        }
+        ring_[head & mask_] = row;
+        head_.store(head + 1, std::memory_order_release);
+    }
+    eof_.store(true, std::memory_order_release);
+}
+
+bool ReplaySource::Pop(Row& out)
+{
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    while (head_.load(std::memory_order_acquire) == tail) {
+        // eof_ is published after the last head_ store, so re-check head once it is set
+        if (eof_.load(std::memory_order_acquire) && head_.load(std::memory_order_acquire) == tail) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    out = ring_[tail & mask_];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool ReplaySource::Sample(float t_s, Rte::DriverInput& in)
+{
+    if (!parser_) return false;
+    while (!exhausted_) {
+        if (!have_next_) {
+            if (!Pop(next_)) {
+                exhausted_ = true;
+                break;
+            }
+            have_next_ = true;
+            ++consumed_;
+        }
+        if (next_.t > t_s + kTimeEpsilon) {
+            in.throttle = next_.throttle;
+            in.brake = next_.brake;
+            in.steer = next_.steer;
+            return true;
+        }
+        have_next_ = false; // row ended at or before t_s
+    }
+    return false;
+}
+
+} // namespace App
@@ -0,0 +1,72 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "swc/driverinput_swc.h"
+
+namespace App {
+
+/**
+ * @brief Streams recorded throttle/brake/steer into Swc::DriverInput
+ *
+ * Reads a log written by Bsw::Logging (CSV, columnar or compressed, detected from the
+ * file contents). A background thread parses ahead into a fixed-size ring,
+ * so memory use does not depend on the recording length. Sample() blocks
+ * rather than skipping when the ring runs dry, so a replay is deterministic
+ * and runs as fast as the reader can parse.
+ *
+ * Each recorded row holds the input applied over the step that ended at its
+ * t, so Sample(t) returns the first row with row.t > t (within half the CSV
+ * time resolution). Replaying a log of the built-in scenario reproduces that
+ * log byte for byte.
+ */
+class ReplaySource final : public Swc::DriverInput::InputSource {
+public:
+    static constexpr std::size_t kDefaultPrefetch = 4096; // samples, rounded up to a power of two
+
+    explicit ReplaySource(std::size_t prefetch_samples = kDefaultPrefetch);
+    ~ReplaySource() override;
+    ReplaySource(const ReplaySource&) = delete;
+    ReplaySource& operator=(const ReplaySource&) = delete;
+
+    // Validates the header and starts prefetching. Returns false and sets err on failure.
+    bool Open(const std::string& path, std::string& err);
+    void Close();
+
+    bool Sample(float t_s, Rte::DriverInput& in) override;
+
+    std::size_t PrefetchCapacity() const { return ring_.size(); }
+    uint64_t SamplesConsumed() const { return consumed_; }
+
+    // Used by the format parsers in replay.cpp
+    struct Row {
+        float t;
+        float throttle, brake, steer;
+    };
+    class Parser;
+
+private:
+    bool Pop(Row& out);
+    void ProducerMain();
+
+    std::vector<Row> ring_; // single producer (prefetch thread) / single consumer (Sample)
+    std::size_t mask_ = 0;
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    std::atomic<bool> eof_{false};
+    std::atomic<bool> stop_{false};
+    std::thread producer_;
+    std::unique_ptr<Parser> parser_;
+
+    Row next_{};
+    bool have_next_ = false;
+    bool exhausted_ = false;
+    uint64_t consumed_ = 0;
+};
+
+} // namespace App
@@ -0,0 +1,172 @@
+#include "app/scenario.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "rte/rte.h"
+
+namespace App {
+
+namespace {
+
+// Forward steps tried before falling back to binary search
+constexpr std::size_t kCursorSteps = 4;
+
+struct Segment {
+    float start, end;
+    float from[3], to[3];
+};
+
+// "v" or "a:b"
+bool ParseValue(const std::string& tok, float& from, float& to)
+{
+    char* end = nullptr;
+    from = std::strtof(tok.c_str(), &end);
+    if (end == tok.c_str()) return false;
+    if (*end == '\0') {
+        to = from;
+        return true;
+    }
+    if (*end != ':') return false;
+    const char* second = end + 1;
+    to = std::strtof(second, &end);
+    return end != second && *end == '\0';
+}
+
+} // namespace
+
+bool ScenarioSource::LoadFile(const std::string& path, std::string& err)
+{
+    std::ifstream f(path);
+    if (!f) {
+        err = "cannot open " + path;
+        return false;
+    }
+    std::stringstream ss;
+    ss << f.rdbuf();
+    if (!LoadString(ss.str(), err)) {
+        err = path + ": " + err;
+        return false;
+    }
+    return true;
+}
+
+bool ScenarioSource::LoadString(const std::string& text, std::string& err)
+{
+    std::vector<Segment> segs;
+    std::istringstream lines(text);
+    std::string line;
+    for (int lineno = 1; std::getline(lines, line); ++lineno) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        std::string tok[5];
+        int n = 0;
+        while (n < 5 && fields >> tok[n]) ++n;
+        if (n == 0) continue;
+
+        std::string extra;
+        Segment s{};
+        float dummy = 0.0f;
+        const bool ok = n == 5 && !(fields >> extra) &&
+                        ParseValue(tok[0], s.start, dummy) && dummy == s.start &&
+                        ParseValue(tok[1], s.end, dummy) && dummy == s.end &&
+                        ParseValue(tok[2], s.from[0], s.to[0]) &&
+                        ParseValue(tok[3], s.from[1], s.to[1]) &&
+                        ParseValue(tok[4], s.from[2], s.to[2]);
+        if (!ok) {
+            err = "line " + std::to_string(lineno) + ": expected 'start end throttle brake steer'";
+            return false;
+        }
+        if (!(s.start < s.end)) {
+            err = "line " + std::to_string(lineno) + ": start must be before end";
+            return false;
+        }
+        segs.push_back(s);
+    }
+
+    std::stable_sort(segs.begin(), segs.end(),
+                     [](const Segment& a, const Segment& b) { return a.start < b.start; });
+    for (std::size_t i = 1; i < segs.size(); ++i) {
+        if (segs[i].start < segs[i - 1].end) {
+            err = "overlapping segments at t=" + std::to_string(segs[i].start);
+            return false;
+        }
+    }
+
+    start_.clear();
+    end_.clear();
+    ramp_.clear();
+    start_.reserve(segs.size());
+    end_.reserve(segs.size());
+    ramp_.reserve(segs.size());
+    for (const auto& s : segs) {
+        Ramp r{};
+        for (int c = 0; c < 3; ++c) {
+            r.base[c] = s.from[c];
+            r.slope[c] = (s.to[c] == s.from[c]) ? 0.0f : (s.to[c] - s.from[c]) / (s.end - s.start);
+        }
+        start_.push_back(s.start);
+        end_.push_back(s.end);
+        ramp_.push_back(r);
+    }
+    cursor_ = 0;
+    return true;
+}
+
+std::size_t ScenarioSource::FindSegment(float t_s) const
+{
+    // Last segment starting at or before t
+    const auto it = std::upper_bound(start_.begin(), start_.end(), t_s);
+    if (it == start_.begin()) return kNoSegment;
+    const auto i = static_cast<std::size_t>(it - start_.begin()) - 1;
+    return t_s < end_[i] ? i : kNoSegment;
+}
+
+std::size_t ScenarioSource::Seek(float t_s)
+{
+    const std::size_t n = start_.size();
+    if (n == 0) return kNoSegment;
+
+    // cursor_ is the last segment with start <= t of the previous call
+    if (t_s >= start_[cursor_]) {
+        std::size_t steps = 0;
+        while (cursor_ + 1 < n && t_s >= start_[cursor_ + 1] && steps < kCursorSteps) {
+            ++cursor_;
+            ++steps;
+        }
+        if (cursor_ + 1 == n || t_s < start_[cursor_ + 1]) {
+            return t_s < end_[cursor_] ? cursor_ : kNoSegment;
+        }
+    }
+    // Time went backwards or jumped far ahead
+    const auto it = std::upper_bound(start_.begin(), start_.end(), t_s);
+    if (it == start_.begin()) {
+        cursor_ = 0;
+        return kNoSegment;
+    }
+    cursor_ = static_cast<std::size_t>(it - start_.begin()) - 1;
+    return t_s < end_[cursor_] ? cursor_ : kNoSegment;
+}
+
+bool ScenarioSource::Sample(float t_s, Rte::DriverInput& in)
+{
+    if (start_.empty() || t_s >= end_.back()) return false;
+
+    const std::size_t i = Seek(t_s);
+    if (i == kNoSegment) {
+        in.throttle = 0.0f;
+        in.brake = 0.0f;
+        in.steer = 0.0f;
+        return true;
+    }
+    const Ramp& r = ramp_[i];
+    const float dt = t_s - start_[i];
+    in.throttle = r.base[0] + r.slope[0] * dt;
+    in.brake = r.base[1] + r.slope[1] * dt;
+    in.steer = r.base[2] + r.slope[2] * dt;
+    return true;
+}
+
+} // namespace App
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "swc/driverinput_swc.h"
+
+namespace App {
+
+/**
+ * @brief Piecewise driver scenario (throttle/brake/steer) as a sorted table
+ *
+ * Text format, one segment per line, '#' starts a comment:
+ *
+ *     # start_s  end_s  throttle  brake  steer
+ *     0          2      0.6       0      0
+ *     2          5      0.2       0      0:0.3     # steer ramps 0 -> 0.3
+ *
+ * A value is either a constant `v` or a linear ramp `a:b` interpolated over
+ * [start_s, end_s). Segments are sorted on load and must not overlap. Time in
+ * a gap releases all inputs; after the last segment the source is exhausted.
+ *
+ * Sample() keeps a cursor, so monotonic time costs O(1) per tick; any other
+ * access falls back to a binary search over the segment starts.
+ */
+class ScenarioSource final : public Swc::DriverInput::InputSource {
+public:
+    static constexpr std::size_t kNoSegment = static_cast<std::size_t>(-1);
+
+    bool LoadFile(const std::string& path, std::string& err);
+    bool LoadString(const std::string& text, std::string& err);
+
+    bool Sample(float t_s, Rte::DriverInput& in) override;
+
+    // Segment active at t (binary search), or kNoSegment in a gap / outside the table
+    std::size_t FindSegment(float t_s) const;
+
+    std::size_t Size() const { return start_.size(); }
+    float EndTime() const { return end_.empty() ? 0.0f : end_.back(); }
+
+private:
+    // value(t) = base + slope * (t - start); slope is 0 for constants
+    struct Ramp {
+        float base[3];  // throttle, brake, steer
+        float slope[3];
+    };
+
+    std::size_t Seek(float t_s);
+
+    // Segment starts are kept apart from the payload so the search touches one dense array
+    std::vector<float> start_;
+    std::vector<float> end_;
+    std::vector<Ramp> ramp_;
+    std::size_t cursor_ = 0;
+};
+
+} // namespace App
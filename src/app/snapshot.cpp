@@ -0,0 +1,184 @@
+#include "app/snapshot.h"
+
+#include <cstring>
+
+namespace App::Snapshot {
+
+namespace {
+
+constexpr char kMagic[8] = {'S', 'D', 'V', 'S', 'N', 'A', 'P', '1'};
+constexpr std::size_t kHeaderBytes = sizeof(kMagic) + 2 * sizeof(uint32_t);
+
+class Writer {
+public:
+    explicit Writer(std::vector<uint8_t>& out) : out_(out) {}
+
+    void PutBytes(const void* p, std::size_t n)
+    {
+        const std::size_t at = out_.size();
+        out_.resize(at + n);
+        std::memcpy(out_.data() + at, p, n);
+    }
+    template <typename T>
+    void Put(T v) { PutBytes(&v, sizeof(T)); }
+    void PutBool(bool v) { Put<uint8_t>(v ? 1 : 0); }
+
+private:
+    std::vector<uint8_t>& out_;
+};
+
+class Reader {
+public:
+    Reader(const uint8_t* data, std::size_t size) : p_(data), end_(data + size) {}
+
+    template <typename T>
+    bool Get(T& v)
+    {
+        if (static_cast<std::size_t>(end_ - p_) < sizeof(T)) return false;
+        std::memcpy(&v, p_, sizeof(T));
+        p_ += sizeof(T);
+        return true;
+    }
+    bool GetBool(bool& v)
+    {
+        uint8_t b = 0;
+        if (!Get(b)) return false;
+        v = b != 0;
+        return true;
+    }
+    bool AtEnd() const { return p_ == end_; }
+
+private:
+    const uint8_t* p_;
+    const uint8_t* end_;
+};
+
+// The dynamic part of a Context, copied out through the RTE API
+struct State {
+    int64_t tick = 0;
+    Rte::DriverInput driver_input{};
+    Rte::ActuatorCmd actuator_cmd{};
+    Rte::VehicleState vehicle_state{};
+    Rte::Safety safety{};
+    Rte::SteeringPim steering{};
+    Rte::DiagPim diag{};
+};
+
+// Alive counters and deadline monitors of Diag supervision
+template <typename Io, typename D>
+bool DiagFields(Io& io, D& d)
+{
+    for (std::size_t i = 0; i < Rte::kSupervisedEntities; ++i) {
+        uint32_t count = d.alive[i].count.load(std::memory_order_relaxed);
+        auto& m = d.monitor[i];
+        if (!(io.Get(count) && io.GetBool(m.started) && io.Get(m.seen) && io.Get(m.deadline_ms) &&
+              io.Get(m.failed_cycles) && io.Get(m.missed_total) && io.Get(m.status))) {
+            return false;
+        }
+        d.alive[i].count.store(count, std::memory_order_relaxed);
+    }
+    return io.Get(d.supervision_ms);
+}
+
+// Single field list shared by Save and Restore, so the two cannot drift apart
+template <typename Io, typename S>
+bool Fields(Io& io, S& s)
+{
+    return io.Get(s.tick) &&
+           io.Get(s.driver_input.throttle) && io.Get(s.driver_input.brake) && io.Get(s.driver_input.steer) &&
+           io.Get(s.actuator_cmd.drive_accel_cmd) && io.Get(s.actuator_cmd.brake_decel_cmd) &&
+           io.Get(s.actuator_cmd.steer_angle_cmd) &&
+           io.Get(s.vehicle_state.t) && io.Get(s.vehicle_state.x) && io.Get(s.vehicle_state.y) &&
+           io.Get(s.vehicle_state.yaw) && io.Get(s.vehicle_state.v) && io.Get(s.vehicle_state.yaw_rate) &&
+           io.Get(s.vehicle_state.wheel_omega) &&
+           io.GetBool(s.safety.estop) && io.Get(s.safety.system_state) &&
+           io.Get(s.steering.steer_angle) &&
+           io.Get(s.diag.heartbeat) && DiagFields(io, s.diag);
+}
+
+// Adapts Writer to the Get-style field list above
+struct SaveIo {
+    Writer& w;
+    template <typename T>
+    bool Get(const T& v) { w.Put(v); return true; }
+    bool GetBool(bool v) { w.PutBool(v); return true; }
+};
+
+} // namespace
+
+void Save(const Rte::Context& ctx, int64_t tick, std::vector<uint8_t>& out)
+{
+    State s;
+    s.tick = tick;
+    s.driver_input = Rte::Rte_Read_DriverInput(ctx);
+    s.actuator_cmd = Rte::Rte_Read_ActuatorCmd(ctx);
+    s.vehicle_state = Rte::Rte_Read_VehicleState(ctx);
+    s.safety = Rte::Rte_Read_Safety(ctx);
+    s.steering = ctx.steering;
+    s.diag = ctx.diag;
+
+    out.clear();
+    Writer w(out);
+    w.PutBytes(kMagic, sizeof(kMagic));
+    w.Put(kVersion);
+    w.Put(uint32_t{0}); // payload size, patched below
+    SaveIo io{w};
+    Fields(io, s);
+
+    const auto payload = static_cast<uint32_t>(out.size() - kHeaderBytes);
+    std::memcpy(out.data() + sizeof(kMagic) + sizeof(uint32_t), &payload, sizeof(payload));
+}
+
+std::vector<uint8_t> Save(const Rte::Context& ctx, int64_t tick)
+{
+    std::vector<uint8_t> out;
+    Save(ctx, tick, out);
+    return out;
+}
+
+bool Restore(const uint8_t* data, std::size_t size, Rte::Context& ctx, int64_t& tick, std::string& err)
+{
+    if (size < kHeaderBytes || std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+        err = "not a simulation snapshot";
+        return false;
+    }
+    Reader r(data + sizeof(kMagic), size - sizeof(kMagic));
+    uint32_t version = 0;
+    uint32_t payload = 0;
+    r.Get(version);
+    r.Get(payload);
+    if (version != kVersion) {
+        err = "unsupported snapshot version " + std::to_string(version);
+        return false;
+    }
+    if (payload != size - kHeaderBytes) {
+        err = "truncated snapshot";
+        return false;
+    }
+
+    State s;
+    bool valid = Fields(r, s) && r.AtEnd() && static_cast<uint8_t>(s.safety.system_state) <= 2;
+    for (const auto& m : s.diag.monitor) {
+        valid = valid && static_cast<uint8_t>(m.status) <= 2;
+    }
+    if (!valid) {
+        err = "corrupt snapshot payload";
+        return false;
+    }
+
+    Rte::Rte_Write_DriverInput(ctx, s.driver_input);
+    Rte::Rte_Write_ActuatorCmd(ctx, s.actuator_cmd);
+    Rte::Rte_Write_VehicleState(ctx, s.vehicle_state);
+    Rte::Rte_Write_Safety(ctx, s.safety);
+    ctx.steering = s.steering;
+    ctx.diag = s.diag;
+    tick = s.tick;
+    return true;
+}
+
+bool Restore(const std::vector<uint8_t>& blob, Rte::Context& ctx, int64_t& tick, std::string& err)
+{
+    return Restore(blob.data(), blob.size(), ctx, tick, err);
+}
+
+} // namespace App::Snapshot
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rte/rte.h"
+
+/**
+ * Simulation snapshot: the complete dynamic state of one ECU instance plus the
+ * scheduler tick, as a compact binary blob, so runs can fork from a checkpoint.
+ *
+ * Layout (little-endian, 248 bytes in version 2):
+ *
+ *     "SDVSNAP1" | u32 version | u32 payload bytes | payload
+ *     payload: u64 tick | DriverInput | ActuatorCmd | VehicleState | Safety
+ *              | SteeringPim | DiagPim (heartbeat, then alive count + deadline
+ *              monitor per supervised entity, supervision time)
+ *              Fields in declaration order. Version 1 had no supervision state.
+ *
+ * Not part of the snapshot:
+ *  - Calibration: configuration, not state. Restore keeps the target's
+ *    calibration, so forked variants run with their own parameters.
+ *  - The DriverInput source (Context::driver): the caller owns it and attaches
+ *    it again. A stateless source (built-in, ScenarioSource) resumes exactly.
+ */
+namespace App::Snapshot {
+
+constexpr uint32_t kVersion = 2;
+
+// Serialises ctx and the scheduler tick into out (cleared first, capacity reused)
+void Save(const Rte::Context& ctx, int64_t tick, std::vector<uint8_t>& out);
+std::vector<uint8_t> Save(const Rte::Context& ctx, int64_t tick);
+
+// Restores ports and per-instance memory of ctx from a blob written by Save().
+// Returns false and fills err (ctx untouched) on a malformed or foreign blob.
+bool Restore(const uint8_t* data, std::size_t size, Rte::Context& ctx, int64_t& tick, std::string& err);
+bool Restore(const std::vector<uint8_t>& blob, Rte::Context& ctx, int64_t& tick, std::string& err);
+
+} // namespace App::Snapshot
@@ -0,0 +1,180 @@
+#include "app/sweep.h"
+#include "app/ecu.h"
+#include "app/snapshot.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+namespace App::Sweep {
+
+void Metrics::Observe(const Rte::Context& ctx)
+{
+    const auto st = Rte::Rte_Read_VehicleState(ctx);
+    s.max_speed_mps = std::max(s.max_speed_mps, st.v);
+    s.distance_m += std::hypot(st.x - prev_x, st.y - prev_y);
+    prev_x = st.x;
+    prev_y = st.y;
+
+    if (!braking && Rte::Rte_Read_ActuatorCmd(ctx).brake_decel_cmd > 0.0f) {
+        braking = true;
+        brake_t = st.t;
+        brake_odo = s.distance_m;
+    }
+    if (braking && s.stopping_time_s < 0.0f && st.v <= 0.0f) {
+        s.stopping_time_s = st.t - brake_t;
+        s.stopping_distance_m = s.distance_m - brake_odo;
+    }
+}
+
+bool ParseDimension(const std::string& spec, Dist dist, Dimension& out, std::string& err)
+{
+    const auto eq = spec.find('=');
+    if (eq == std::string::npos) {
+        err = "expected name=values: " + spec;
+        return false;
+    }
+    out = Dimension{};
+    out.dist = dist;
+    out.param = FindParam(spec.substr(0, eq));
+    if (!out.param) {
+        err = "unknown parameter: " + spec.substr(0, eq);
+        return false;
+    }
+
+    std::vector<double> v;
+    const char* p = spec.c_str() + eq + 1;
+    while (*p) {
+        char* end = nullptr;
+        v.push_back(std::strtod(p, &end));
+        if (end == p) break;
+        p = (*end == ':') ? end + 1 : end;
+    }
+
+    const std::size_t expected = (dist == Dist::Grid) ? 3 : 2;
+    if (v.size() != expected || *p != '\0') {
+        err = "malformed values for " + std::string(out.param->name) + ": " + spec.substr(eq + 1);
+        return false;
+    }
+    for (const double x : v) {
+        if (!std::isfinite(x) || std::fabs(x) > std::numeric_limits<float>::max()) {
+            err = "values must be finite floats: " + spec;
+            return false;
+        }
+    }
+    out.a = static_cast<float>(v[0]);
+    out.b = static_cast<float>(v[1]);
+    // The same ranges a calibration file is held to (model/param_limits.h); a
+    // normal draw outside it is redrawn by MakeCalibration
+    const auto& range = out.param->range;
+    if (!range.Contains(out.a) || (dist != Dist::Normal && !range.Contains(out.b))) {
+        char bounds_text[64];
+        std::snprintf(bounds_text, sizeof(bounds_text), "%s%g, %g]", range.lo_open ? "(" : "[",
+                      static_cast<double>(range.lo), static_cast<double>(range.hi));
+        err = spec + " is outside " + bounds_text;
+        return false;
+    }
+    // std::uniform_real_distribution needs a <= b, std::normal_distribution stddev > 0
+    if (dist == Dist::Uniform && !(out.a <= out.b)) {
+        err = "uniform range needs lo <= hi: " + spec;
+        return false;
+    }
+    if (dist == Dist::Normal && !(out.b > 0.0f)) {
+        err = "normal stddev must be > 0: " + spec;
+        return false;
+    }
+    if (dist == Dist::Grid) {
+        if (v[2] < 1.0 || v[2] > static_cast<double>(kMaxGridCount) || v[2] != std::floor(v[2])) {
+            err = "grid count must be an integer in 1.." + std::to_string(kMaxGridCount) + ": " + spec;
+            return false;
+        }
+        out.count = static_cast<std::size_t>(v[2]);
+    }
+    return true;
+}
+
+std::size_t RunCount(const Plan& plan)
+{
+    std::size_t n = plan.samples;
+    for (const auto& d : plan.dims) {
+        if (d.dist != Dist::Grid) continue;
+        if (d.count != 0 && n > std::numeric_limits<std::size_t>::max() / d.count) return 0;
+        n *= d.count;
+    }
+    return n;
+}
+
+Rte::Calibration MakeCalibration(const Plan& plan, std::size_t index)
+{
+    Rte::Calibration c = plan.base;
+
+    // index = grid_point * samples + sample; the first grid dimension varies slowest
+    std::size_t grid_point = index / plan.samples;
+    for (auto it = plan.dims.rbegin(); it != plan.dims.rend(); ++it) {
+        if (it->dist != Dist::Grid) continue;
+        const std::size_t k = grid_point % it->count;
+        grid_point /= it->count;
+        const float step = (it->count > 1) ? (it->b - it->a) / static_cast<float>(it->count - 1) : 0.0f;
+        it->param->field(c) = it->a + step * static_cast<float>(k);
+    }
+
+    std::mt19937_64 rng(plan.seed * 0x9E3779B97F4A7C15ull + index);
+    for (const auto& d : plan.dims) {
+        if (d.dist == Dist::Uniform) {
+            d.param->field(c) = std::uniform_real_distribution<float>(d.a, d.b)(rng);
+        } else if (d.dist == Dist::Normal) {
+            std::normal_distribution<float> normal(d.a, d.b);
+            float x = normal(rng);
+            for (int k = 0; k < kMaxRedraws && !d.param->range.Contains(x); ++k) x = normal(rng);
+            d.param->field(c) = d.param->range.Contains(x) ? x : d.a;
+        }
+    }
+    return c;
+}
+
+Checkpoint RunPrefix(const Rte::Calibration& calib, double seconds)
+{
+    Rte::Context ctx;
+    ctx.calib = calib;
+    App::InitEcu(ctx);
+
+    Checkpoint cp;
+    Bsw::TimeBase::Scheduler sched;
+    App::RegisterTasks(sched, ctx);
+    sched.AddTask10ms([&] { cp.metrics.Observe(ctx); });
+    sched.RunForSeconds(seconds);
+
+    Snapshot::Save(ctx, sched.Tick(), cp.snapshot);
+    return cp;
+}
+
+Summary RunScenario(const Rte::Calibration& calib, double seconds, const Checkpoint* from)
+{
+    Rte::Context ctx;
+    ctx.calib = calib;
+    App::InitEcu(ctx);
+
+    Metrics m;
+    Bsw::TimeBase::Scheduler sched;
+    App::RegisterTasks(sched, ctx);
+    sched.AddTask10ms([&] { m.Observe(ctx); });
+
+    int64_t tick = 0;
+    if (from) {
+        std::string err;
+        if (!Snapshot::Restore(from->snapshot, ctx, tick, err)) {
+            std::fprintf(stderr, "sdv_sweep: %s\n", err.c_str());
+            std::abort();
+        }
+        sched.SetTick(tick);
+        m = from->metrics;
+    }
+    sched.RunForSeconds(seconds - static_cast<double>(tick) * kDt10ms);
+
+    m.s.final_state = Rte::Rte_Read_VehicleState(ctx);
+    return m.s;
+}
+
+} // namespace App::Sweep
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bsw/calib_store.h"
+#include "rte/rte.h"
+
+// Monte Carlo / grid parameter sweep over Rte::Calibration
+namespace App::Sweep {
+
+// Calibration field addressed by name, e.g. "brake.max_decel_mps2"
+using ParamRef = Bsw::Calib::Param;
+
+// All sweepable calibration fields (the calibration file names, see bsw/calib_store.h)
+inline const std::vector<ParamRef>& Params() { return Bsw::Calib::Params(); }
+inline const ParamRef* FindParam(const std::string& name) { return Bsw::Calib::FindParam(name); }
+
+enum class Dist : uint8_t {
+    Grid = 0,    // count values evenly spaced in [a, b] (cartesian product over grid dims)
+    Uniform = 1, // uniform in [a, b), drawn per sample
+    Normal = 2   // mean a, stddev b, drawn per sample
+};
+
+struct Dimension {
+    const ParamRef* param = nullptr;
+    Dist dist = Dist::Grid;
+    float a = 0.0f;
+    float b = 0.0f;
+    std::size_t count = 1; // Grid only
+};
+
+constexpr std::size_t kMaxGridCount = 1000000; // per grid dimension
+constexpr int kMaxRedraws = 1000;              // normal draws outside the parameter's range, then the mean
+
+// Parses "name=lo:hi:count" (Grid), "name=lo:hi" (Uniform) or "name=mean:stddev" (Normal).
+// Returns false and fills err on malformed input, a fractional or out-of-range
+// grid count, uniform lo > hi, a normal stddev <= 0, or grid/uniform bounds or
+// a normal mean outside the parameter's range (Bsw::Calib::Param::range).
+bool ParseDimension(const std::string& spec, Dist dist, Dimension& out, std::string& err);
+
+struct Plan {
+    std::vector<Dimension> dims;
+    std::size_t samples = 1; // random draws per grid point
+    uint64_t seed = 1;
+    Rte::Calibration base{};
+    double fork_at_s = 0.0; // > 0: simulate [0, fork_at_s) once with `base`, fork every run from there
+};
+
+// samples x every grid count; 0 if that overflows size_t
+std::size_t RunCount(const Plan& plan);
+
+// Calibration of run `index`. Random draws depend only on (seed, index),
+// so results do not depend on which thread ran which sample. Normal draws
+// outside the parameter's range are redrawn (kMaxRedraws, then the mean).
+Rte::Calibration MakeCalibration(const Plan& plan, std::size_t index);
+
+struct Summary {
+    float max_speed_mps = 0.0f;
+    float distance_m = 0.0f;          // path length
+    float stopping_distance_m = -1.0f; // from first brake command to standstill, -1 if it never stopped
+    float stopping_time_s = -1.0f;
+    Rte::VehicleState final_state{};
+};
+
+// Running Summary of one scenario, updated after every 10ms tick
+struct Metrics {
+    Summary s{};
+    bool braking = false;
+    float brake_t = 0.0f;
+    float brake_odo = 0.0f;
+    float prev_x = 0.0f;
+    float prev_y = 0.0f;
+
+    void Observe(const Rte::Context& ctx);
+};
+
+// Shared prefix of a sweep: simulation snapshot (app/snapshot.h) + metrics so far
+struct Checkpoint {
+    std::vector<uint8_t> snapshot;
+    Metrics metrics{};
+};
+
+// Runs the built-in scenario for `seconds` with calib and captures the state at the end
+Checkpoint RunPrefix(const Rte::Calibration& calib, double seconds);
+
+// Runs the built-in scenario on a fresh ECU instance with the given calibration.
+// With `from`, the run resumes at the checkpoint instead of t = 0 (seconds is
+// still the total length); calib only takes effect after the fork point.
+Summary RunScenario(const Rte::Calibration& calib, double seconds, const Checkpoint* from = nullptr);
+
+} // namespace App::Sweep
@@ -0,0 +1,156 @@
+// Stand-in for a driving station talking to `sdv_sim --udp PORT` over
+// loopback UDP: sends DriverInput PDUs every 10ms (the fixed profile, or
+// released pedals with --no-drive), receives the ECU's signal PDUs and prints
+// the vehicle state, with datagram loss and send-to-receive latency at the end.
+//
+// usage: sdv_udp_station [--ecu PORT] [--listen PORT] [--seconds S] [--batch N] [--no-drive] [--print-ms MS]
+//   --ecu       ECU gateway port, default 47000
+//   --listen    local port (default: any; the ECU replies to the sender unless given a peer)
+//   --batch     10ms input cycles packed per datagram, default 1
+//   --print-ms  period of the state printout (0 = silent), default 500
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "app/drive_profile.h"
+#include "bsw/com.h"
+#include "bsw/profiler.h"
+
+int main(int argc, char** argv)
+{
+    unsigned ecu_port = 47000;
+    unsigned listen_port = 0;
+    double seconds = 10.0;
+    long batch = 1;
+    bool drive = true;
+    int print_ms = 500;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--ecu") == 0 && i + 1 < argc) {
+            ecu_port = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--listen") == 0 && i + 1 < argc) {
+            listen_port = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            seconds = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            batch = std::strtol(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--no-drive") == 0) {
+            drive = false;
+        } else if (std::strcmp(argv[i], "--print-ms") == 0 && i + 1 < argc) {
+            print_ms = std::atoi(argv[++i]);
+        } else {
+            std::fprintf(stderr, "usage: sdv_udp_station [--ecu PORT] [--listen PORT] [--seconds S] [--batch N] "
+                                 "[--no-drive] [--print-ms MS]\n");
+            return 2;
+        }
+    }
+    if (ecu_port == 0 || ecu_port > 65535 || listen_port > 65535 || batch < 1) {
+        std::fprintf(stderr, "sdv_udp_station: invalid port or batch\n");
+        return 2;
+    }
+
+    Bsw::Com::UdpSocket sock;
+    std::string err;
+    if (!sock.Open(static_cast<uint16_t>(listen_port), err)) {
+        std::fprintf(stderr, "sdv_udp_station: %s\n", err.c_str());
+        return 1;
+    }
+    sock.SetPeer(static_cast<uint16_t>(ecu_port));
+
+    Bsw::Com::DatagramBuilder tx;
+    tx.SetSession(Bsw::Com::NewSession());
+    Bsw::Com::PduBatch rx;
+    Bsw::TimeBase::LatencyHistogram latency;
+    Rte::VehicleState st;
+    Rte::Safety sf;
+    uint16_t cycle = 0;
+    uint32_t tx_seq = 0;
+    long batched = 0;
+    uint64_t datagrams = 0;
+    uint64_t states = 0;
+    uint64_t lost = 0;
+    uint64_t malformed = 0;
+    bool have_seq = false;
+    uint32_t ecu_session = 0;
+    uint32_t next_seq = 0;
+
+    const auto t0 = std::chrono::steady_clock::now();
+    auto next_input = t0;
+    auto next_print = t0;
+    auto last_rx = t0;
+    bool ecu_silent = false;
+    for (;;) {
+        const auto now = std::chrono::steady_clock::now();
+        const double t = std::chrono::duration<double>(now - t0).count();
+        if (t >= seconds) break;
+
+        if (now >= next_input) {
+            // Released pedals with --no-drive: the ECU only answers the sender of an input
+            tx.Add(cycle, drive ? App::DriveProfile(t) : Rte::DriverInput{});
+            ++cycle;
+            if (++batched >= batch) {
+                tx.Finish(tx_seq, Bsw::Com::NowNs());
+                tx_seq += static_cast<uint32_t>(tx.DatagramCount());
+                sock.Send(tx);
+                tx.Clear();
+                batched = 0;
+            }
+            next_input += std::chrono::milliseconds(10);
+        }
+
+        const auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(next_input - now).count();
+        if (!sock.WaitReadable(static_cast<int>(wait > 0 ? wait : 0))) {
+            if (datagrams > 0 && now - last_rx > std::chrono::seconds(1)) {
+                ecu_silent = true;
+                break;
+            }
+            continue;
+        }
+        std::size_t n;
+        while ((n = sock.Receive()) > 0) {
+            const int64_t rx_ns = Bsw::Com::NowNs();
+            last_rx = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < n; ++i) {
+                if (!Bsw::Com::DecodeDatagram(sock.RxData(i), sock.RxSize(i), rx)) {
+                    ++malformed;
+                    continue;
+                }
+                ++datagrams;
+                // A restarted ECU numbers its datagrams from 0 again
+                if (have_seq && rx.session == ecu_session && rx.seq != next_seq) lost += rx.seq - next_seq;
+                have_seq = true;
+                ecu_session = rx.session;
+                next_seq = rx.seq + 1;
+                latency.Record(rx_ns - rx.stamp_ns);
+                for (const auto& e : rx.pdus) {
+                    if (e.id == Bsw::Com::PduId::VehicleState) {
+                        st = e.vehicle_state;
+                        ++states;
+                    } else if (e.id == Bsw::Com::PduId::Safety) {
+                        if (e.safety.estop && !sf.estop) std::printf("t=%.2f E-Stop\n", static_cast<double>(st.t));
+                        sf = e.safety;
+                    }
+                }
+            }
+            if (n < Bsw::Com::UdpSocket::kRecvBatch) break;
+        }
+        if (print_ms > 0 && states > 0 && last_rx >= next_print) {
+            std::printf("t=%7.2f x=%8.3f y=%8.3f yaw=%7.3f v=%6.3f state=%u\n", static_cast<double>(st.t),
+                        static_cast<double>(st.x), static_cast<double>(st.y), static_cast<double>(st.yaw),
+                        static_cast<double>(st.v), static_cast<unsigned>(sf.system_state));
+            next_print = last_rx + std::chrono::milliseconds(print_ms);
+        }
+    }
+
+    std::printf("%s%llu VehicleState PDUs in %llu datagrams, %llu lost, %llu malformed; "
+                "latency min %llu ns, p50 %llu ns, p99 %llu ns, max %llu ns\n",
+                ecu_silent ? "ECU went silent. " : "", static_cast<unsigned long long>(states),
+                static_cast<unsigned long long>(datagrams), static_cast<unsigned long long>(lost),
+                static_cast<unsigned long long>(malformed), static_cast<unsigned long long>(latency.MinNs()),
+                static_cast<unsigned long long>(latency.QuantileNs(0.50)),
+                static_cast<unsigned long long>(latency.QuantileNs(0.99)),
+                static_cast<unsigned long long>(latency.MaxNs()));
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include "app/work_stealing_pool.h"
+#include <algorithm>
+
+namespace App {
+
+WorkStealingPool::WorkStealingPool(unsigned threads)
+{
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (unsigned i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    for (unsigned i = 0; i < threads; ++i) {
+        workers_.emplace_back([this, i] { WorkerMain(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        stop_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& w : workers_) w.join();
+}
+
+void WorkStealingPool::ParallelFor(std::size_t count, const std::function<void(std::size_t)>& fn)
+{
+    if (count == 0) return;
+
+    std::unique_lock<std::mutex> lk(m_);
+
+    // Deal out contiguous blocks: neighbouring indices stay on one worker
+    const std::size_t n = queues_.size();
+    const std::size_t block = (count + n - 1) / n;
+    for (std::size_t w = 0; w < n; ++w) {
+        std::lock_guard<std::mutex> qlk(queues_[w]->m);
+        const std::size_t begin = std::min(count, w * block);
+        const std::size_t end = std::min(count, begin + block);
+        for (std::size_t i = begin; i < end; ++i) {
+            queues_[w]->jobs.push_back(i);
+        }
+    }
+
+    fn_ = &fn;
+    remaining_ = count;
+    ++generation_;
+    start_cv_.notify_all();
+    // Also wait for every worker to leave its job loop, so none of them can
+    // pick up jobs of the next call with this call's fn.
+    done_cv_.wait(lk, [this] { return remaining_ == 0 && active_ == 0; });
+    fn_ = nullptr;
+}
+
+bool WorkStealingPool::PopLocal(unsigned id, std::size_t& job)
+{
+    Queue& q = *queues_[id];
+    std::lock_guard<std::mutex> lk(q.m);
+    if (q.jobs.empty()) return false;
+    job = q.jobs.front();
+    q.jobs.pop_front();
+    return true;
+}
+
+bool WorkStealingPool::Steal(unsigned id, std::size_t& job)
+{
+    const unsigned n = Size();
+    for (unsigned k = 1; k < n; ++k) {
+        Queue& victim = *queues_[(id + k) % n];
+        std::lock_guard<std::mutex> lk(victim.m);
+        if (!victim.jobs.empty()) {
+            job = victim.jobs.back();
+            victim.jobs.pop_back();
+            steals_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::WorkerMain(unsigned id)
+{
+    uint64_t seen = 0;
+    for (;;) {
+        const std::function<void(std::size_t)>* fn = nullptr;
+        {
+            std::unique_lock<std::mutex> lk(m_);
+            start_cv_.wait(lk, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+            fn = fn_;
+            if (!fn) continue; // woke up after that call already finished
+            ++active_;
+        }
+
+        std::size_t done = 0;
+        std::size_t job = 0;
+        while (PopLocal(id, job) || Steal(id, job)) {
+            (*fn)(job);
+            ++done;
+        }
+
+        std::lock_guard<std::mutex> lk(m_);
+        remaining_ -= done;
+        --active_;
+        if (remaining_ == 0 && active_ == 0) done_cv_.notify_all();
+    }
+}
+
+} // namespace App
@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace App {
+
+/**
+ * @brief Fixed set of worker threads with per-worker deques and stealing
+ *
+ * ParallelFor() deals the index range out to the workers in contiguous
+ * blocks. A worker pops from the front of its own deque; once that is empty
+ * it steals from the back of a victim's deque, so uneven job costs
+ * (e.g. scenarios that stop early) still keep every core busy.
+ */
+class WorkStealingPool {
+public:
+    // threads == 0 -> std::thread::hardware_concurrency()
+    explicit WorkStealingPool(unsigned threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    unsigned Size() const { return static_cast<unsigned>(workers_.size()); }
+
+    // Runs fn(i) for every i in [0, count) and blocks until all calls returned.
+    // fn must be safe to call concurrently for different i.
+    void ParallelFor(std::size_t count, const std::function<void(std::size_t)>& fn);
+
+    // Number of jobs taken from another worker's deque since construction
+    uint64_t StealCount() const { return steals_.load(std::memory_order_relaxed); }
+
+private:
+    struct Queue {
+        std::mutex m;
+        std::deque<std::size_t> jobs;
+    };
+
+    void WorkerMain(unsigned id);
+    bool PopLocal(unsigned id, std::size_t& job);
+    bool Steal(unsigned id, std::size_t& job);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::mutex m_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    const std::function<void(std::size_t)>* fn_ = nullptr;
+    uint64_t generation_ = 0;
+    std::size_t remaining_ = 0; // jobs of the current call not finished yet
+    unsigned active_ = 0;       // workers inside their job loop
+    bool stop_ = false;
+
+    std::atomic<uint64_t> steals_{0};
+};
+
+} // namespace App
@@ -0,0 +1,181 @@
+#include "bsw/calib_store.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace Bsw::Calib {
+
+#define SDV_CALIB_PARAM(group, member, range) \
+    Param{#group "." #member, [](Rte::Calibration& c) -> float& { return c.group.member; }, Model::Limits::range}
+
+const std::vector<Param>& Params()
+{
+    static const std::vector<Param> params{
+        SDV_CALIB_PARAM(engine, max_accel_mps2, kMaxAccelMps2),
+        SDV_CALIB_PARAM(brake, max_decel_mps2, kMaxDecelMps2),
+        SDV_CALIB_PARAM(brake, estop_max_decel_mps2, kEstopMaxDecelMps2),
+        SDV_CALIB_PARAM(steering, max_steer_angle_rad, kMaxSteerAngleRad),
+        SDV_CALIB_PARAM(steering, steer_tau_s, kSteerTauS),
+        SDV_CALIB_PARAM(vehicle, wheel_radius_m, kWheelRadiusM),
+        SDV_CALIB_PARAM(vehicle, wheelbase_m, kWheelbaseM),
+        SDV_CALIB_PARAM(vehicle, linear_drag, kLinearDrag),
+        SDV_CALIB_PARAM(vehicle, max_speed_mps, kMaxSpeedMps),
+        SDV_CALIB_PARAM(vehicle, estop_decel_mps2, kEstopDecelMps2),
+    };
+    return params;
+}
+
+#undef SDV_CALIB_PARAM
+
+const Param* FindParam(const std::string& name)
+{
+    for (const auto& p : Params()) {
+        if (name == p.name) return &p;
+    }
+    return nullptr;
+}
+
+namespace {
+
+std::string Trim(const std::string& s)
+{
+    const auto b = s.find_first_not_of(" \t\r");
+    if (b == std::string::npos) return {};
+    const auto e = s.find_last_not_of(" \t\r");
+    return s.substr(b, e - b + 1);
+}
+
+} // namespace
+
+bool Parse(const std::string& text, Rte::Calibration& calib, std::string& err)
+{
+    Rte::Calibration out = calib;
+    std::istringstream in(text);
+    std::string line;
+    for (int line_no = 1; std::getline(in, line); ++line_no) {
+        line = Trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+
+        const auto eq = line.find('=');
+        const Param* p = eq == std::string::npos ? nullptr : FindParam(Trim(line.substr(0, eq)));
+        if (!p) {
+            err = "line " + std::to_string(line_no) + ": unknown parameter: " + line;
+            return false;
+        }
+        const std::string value = Trim(line.substr(eq + 1));
+        char* end = nullptr;
+        const float v = std::strtof(value.c_str(), &end);
+        if (value.empty() || *end != '\0') {
+            err = "line " + std::to_string(line_no) + ": malformed value for " + p->name + ": " + value;
+            return false;
+        }
+        if (!p->range.Contains(v)) {
+            char range[64];
+            std::snprintf(range, sizeof(range), "%s%g, %g]", p->range.lo_open ? "(" : "[",
+                          static_cast<double>(p->range.lo), static_cast<double>(p->range.hi));
+            err = "line " + std::to_string(line_no) + ": " + p->name + " = " + value + " is outside " + range;
+            return false;
+        }
+        p->field(out) = v;
+    }
+    calib = out;
+    return true;
+}
+
+bool LoadFile(const std::string& path, Rte::Calibration& calib, std::string& err)
+{
+    std::ifstream f(path);
+    if (!f) {
+        err = "cannot open " + path;
+        return false;
+    }
+    std::stringstream ss;
+    ss << f.rdbuf();
+    if (!Parse(ss.str(), calib, err)) {
+        err = path + ": " + err;
+        return false;
+    }
+    return true;
+}
+
+bool Store::Open(const std::string& path, const Rte::Calibration& base, std::string& err)
+{
+    path_ = path;
+    base_ = base;
+    return Reload(err);
+}
+
+bool Store::Reload(std::string& err)
+{
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(path_, ec);
+    const auto size = std::filesystem::file_size(path_, ec);
+    Rte::Calibration c = base_;
+    if (!LoadFile(path_, c, err)) return false;
+    mtime_ = mtime;
+    size_ = size;
+    Publish(c);
+    return true;
+}
+
+bool Store::Poll(std::string& err)
+{
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(path_, ec);
+    if (ec) return false; // e.g. mid-replace by an editor; try again next poll
+    const auto size = std::filesystem::file_size(path_, ec);
+    if (ec || (mtime == mtime_ && size == size_)) return false;
+    if (!Reload(err)) {
+        // Remember the broken version so it is reported once, not on every poll
+        mtime_ = mtime;
+        size_ = size;
+        return false;
+    }
+    return true;
+}
+
+void Store::Publish(const Rte::Calibration& calib)
+{
+    current_ = calib;
+    slots_[back_] = calib;
+    back_ = shared_.exchange(static_cast<uint8_t>(back_ | kDirty), std::memory_order_acq_rel) & 0x3;
+    generation_.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool Store::Apply(Rte::Context& ctx)
+{
+    if ((shared_.load(std::memory_order_relaxed) & kDirty) == 0) return false;
+    front_ = shared_.exchange(front_, std::memory_order_acq_rel) & 0x3;
+    ctx.calib = slots_[front_];
+    ++ctx.calib_seq;
+    return true;
+}
+
+void Store::StartWatcher(std::chrono::milliseconds period)
+{
+    StopWatcher();
+    stop_.store(false);
+    watcher_ = std::thread([this, period] {
+        while (!stop_.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(period);
+            std::string err;
+            if (Poll(err)) {
+                std::fprintf(stderr, "Calib: reloaded %s (generation %llu)\n", path_.c_str(),
+                             static_cast<unsigned long long>(Generation()));
+            } else if (!err.empty()) {
+                std::fprintf(stderr, "Calib: keeping previous set: %s\n", err.c_str());
+            }
+        }
+    });
+}
+
+void Store::StopWatcher()
+{
+    if (!watcher_.joinable()) return;
+    stop_.store(true, std::memory_order_release);
+    watcher_.join();
+}
+
+} // namespace Bsw::Calib
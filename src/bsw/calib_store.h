@@ -0,0 +1,94 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "model/param_limits.h"
+#include "rte/rte.h"
+
+// Calibration (Rte::Calibration) loaded from a text file and hot-swapped
+// between ticks while the simulation runs.
+namespace Bsw::Calib {
+
+// Calibration field addressed by name, e.g. "brake.max_decel_mps2"
+struct Param {
+    const char* name;
+    float& (*field)(Rte::Calibration& c);
+    Model::Limits::Range range; // values a file may set (model/param_limits.h)
+};
+
+// All named float fields of Rte::Calibration (also the sdv_sweep parameter names)
+const std::vector<Param>& Params();
+const Param* FindParam(const std::string& name);
+
+// Applies "name = value" lines ('#' starts a comment) on top of calib.
+// Returns false and fills err (with the line number) on an unknown name, a
+// malformed value or a value outside the parameter's range (NaN and inf
+// included); calib is then left unchanged, so a bad file is never published.
+bool Parse(const std::string& text, Rte::Calibration& calib, std::string& err);
+bool LoadFile(const std::string& path, Rte::Calibration& calib, std::string& err);
+
+/**
+ * @brief Calibration file with lock-free publication to one ECU thread
+ *
+ * One loader (Open/Reload/Poll, or the watcher thread) parses the file on top
+ * of the base calibration and publishes complete sets through a triple
+ * buffer; the ECU thread picks up the newest set with Apply() between ticks.
+ * Apply() never locks or allocates: one atomic exchange and a copy of a
+ * trivially copyable struct. A set that fails to parse is not published.
+ */
+class Store {
+public:
+    Store() = default;
+    ~Store() { StopWatcher(); }
+    Store(const Store&) = delete;
+    Store& operator=(const Store&) = delete;
+
+    // Startup load: base + file. The result is Current() and is also pending for Apply().
+    bool Open(const std::string& path, const Rte::Calibration& base, std::string& err);
+
+    // Loader side: re-parse the file unconditionally / only if its mtime or size changed.
+    // Returns true when a new set was published.
+    bool Reload(std::string& err);
+    bool Poll(std::string& err);
+    void Publish(const Rte::Calibration& calib);
+
+    // ECU side, between ticks: copies the newest published set into ctx.calib.
+    // Returns false (and leaves ctx untouched) when nothing new was published.
+    bool Apply(Rte::Context& ctx);
+
+    // Last set parsed by the loader (loader side only)
+    const Rte::Calibration& Current() const { return current_; }
+    uint64_t Generation() const { return generation_.load(std::memory_order_relaxed); }
+
+    // Background Poll() every period; reload errors are reported on stderr
+    void StartWatcher(std::chrono::milliseconds period);
+    void StopWatcher();
+
+private:
+    static_assert(std::is_trivially_copyable_v<Rte::Calibration>, "Apply() must be a plain copy");
+    static constexpr uint8_t kDirty = 0x4; // set in shared_ when slots_[shared_ & 3] is unread
+
+    std::string path_;
+    Rte::Calibration base_{};
+    Rte::Calibration current_{};
+    std::filesystem::file_time_type mtime_{};
+    uintmax_t size_ = 0;
+
+    std::array<Rte::Calibration, 3> slots_{};
+    uint8_t back_ = 0;                  // loader's slot
+    std::atomic<uint8_t> shared_{1};    // exchanged slot (+ kDirty)
+    uint8_t front_ = 2;                 // ECU's slot
+    std::atomic<uint64_t> generation_{0};
+
+    std::atomic<bool> stop_{false};
+    std::thread watcher_;
+};
+
+} // namespace Bsw::Calib
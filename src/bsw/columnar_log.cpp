@@ -0,0 +1,280 @@
+#include "bsw/columnar_log.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Bsw::ColumnarLog {
+
+namespace {
+
+constexpr std::size_t Padded(std::size_t bytes) { return (bytes + 7) & ~std::size_t{7}; }
+
+bool ValidHeader(const FileHeader& h)
+{
+    return std::memcmp(h.magic, kFileMagic, sizeof(h.magic)) == 0 && h.version == kVersion;
+}
+
+bool ParseColumn(ColumnSchema s, std::vector<ColumnInfo>& out)
+{
+    s.name[sizeof(s.name) - 1] = '\0';
+    if (s.type != ColumnType::F32 && s.type != ColumnType::U8) return false;
+    out.push_back(ColumnInfo{s.name, s.type});
+    return true;
+}
+
+int FindColumnIn(const std::vector<ColumnInfo>& columns, const std::string& name)
+{
+    for (std::size_t c = 0; c < columns.size(); ++c) {
+        if (columns[c].name == name) return static_cast<int>(c);
+    }
+    return -1;
+}
+
+} // namespace
+
+void Writer::Open(std::FILE* fp, const std::vector<ColumnDesc>& columns, uint32_t chunk_rows)
+{
+    Close();
+    fp_ = fp;
+    columns_ = columns;
+    chunk_rows_ = std::max<uint32_t>(chunk_rows, 1);
+    rows_ = 0;
+    buffers_.assign(columns_.size(), {});
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        buffers_[c].resize(Padded(chunk_rows_ * TypeSize(columns_[c].type)));
+    }
+
+    FileHeader h{};
+    std::memcpy(h.magic, kFileMagic, sizeof(h.magic));
+    h.version = kVersion;
+    h.column_count = static_cast<uint32_t>(columns_.size());
+    h.chunk_rows = chunk_rows_;
+    std::fwrite(&h, sizeof(h), 1, fp_);
+    for (const auto& c : columns_) {
+        ColumnSchema s{};
+        std::strncpy(s.name, c.name, sizeof(s.name) - 1);
+        s.type = c.type;
+        std::fwrite(&s, sizeof(s), 1, fp_);
+    }
+}
+
+void Writer::Append(const void* row)
+{
+    const auto* src = static_cast<const uint8_t*>(row);
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const std::size_t sz = TypeSize(columns_[c].type);
+        std::memcpy(buffers_[c].data() + rows_ * sz, src + columns_[c].offset, sz);
+    }
+    if (++rows_ == chunk_rows_) {
+        WriteChunk();
+    }
+}
+
+void Writer::WriteChunk()
+{
+    ChunkHeader h{};
+    std::memcpy(h.magic, kChunkMagic, sizeof(h.magic));
+    h.rows = rows_;
+    for (const auto& c : columns_) {
+        h.payload_bytes += Padded(rows_ * TypeSize(c.type));
+    }
+    std::fwrite(&h, sizeof(h), 1, fp_);
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const std::size_t bytes = rows_ * TypeSize(columns_[c].type);
+        std::fill(buffers_[c].begin() + bytes, buffers_[c].begin() + Padded(bytes), 0);
+        std::fwrite(buffers_[c].data(), 1, Padded(bytes), fp_);
+    }
+    rows_ = 0;
+}
+
+void Writer::Flush()
+{
+    if (!fp_) return;
+    if (rows_ > 0) WriteChunk();
+    std::fflush(fp_);
+}
+
+void Writer::Close()
+{
+    if (!fp_) return;
+    Flush();
+    std::fclose(fp_);
+    fp_ = nullptr;
+}
+
+bool Reader::Open(const std::string& path, std::string& err)
+{
+    Close();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        err = "cannot open " + path;
+        return false;
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(fd);
+        err = path + ": not a columnar log (too short)";
+        return false;
+    }
+    void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        err = "mmap failed for " + path;
+        return false;
+    }
+    map_ = static_cast<const uint8_t*>(p);
+    map_size_ = static_cast<std::size_t>(st.st_size);
+
+    FileHeader h;
+    std::memcpy(&h, map_, sizeof(h));
+    if (!ValidHeader(h)) {
+        Close();
+        err = path + ": bad magic or unsupported version";
+        return false;
+    }
+    std::size_t pos = sizeof(FileHeader);
+    if (map_size_ < pos + h.column_count * sizeof(ColumnSchema)) {
+        Close();
+        err = path + ": truncated schema";
+        return false;
+    }
+    for (uint32_t c = 0; c < h.column_count; ++c, pos += sizeof(ColumnSchema)) {
+        ColumnSchema s;
+        std::memcpy(&s, map_ + pos, sizeof(s));
+        if (!ParseColumn(s, columns_)) {
+            Close();
+            err = path + ": unknown column type";
+            return false;
+        }
+    }
+
+    // Index chunks; stop silently at a partially written tail
+    while (pos + sizeof(ChunkHeader) <= map_size_) {
+        ChunkHeader ch;
+        std::memcpy(&ch, map_ + pos, sizeof(ch));
+        if (std::memcmp(ch.magic, kChunkMagic, sizeof(ch.magic)) != 0) break;
+        pos += sizeof(ChunkHeader);
+        if (ch.payload_bytes > map_size_ - pos) break;
+
+        Chunk chunk;
+        chunk.rows = ch.rows;
+        std::size_t off = pos;
+        for (const auto& col : columns_) {
+            chunk.columns.push_back(map_ + off);
+            off += Padded(ch.rows * TypeSize(col.type));
+        }
+        if (off - pos != ch.payload_bytes) {
+            Close();
+            err = path + ": corrupt chunk header";
+            return false;
+        }
+        pos = off;
+        row_count_ += chunk.rows;
+        chunks_.push_back(std::move(chunk));
+    }
+    return true;
+}
+
+void Reader::Close()
+{
+    if (map_) {
+        ::munmap(const_cast<uint8_t*>(map_), map_size_);
+    }
+    map_ = nullptr;
+    map_size_ = 0;
+    columns_.clear();
+    chunks_.clear();
+    row_count_ = 0;
+}
+
+int Reader::FindColumn(const std::string& name) const { return FindColumnIn(columns_, name); }
+
+bool StreamReader::Open(const std::string& path, std::string& err)
+{
+    Close();
+    fp_ = std::fopen(path.c_str(), "rb");
+    if (!fp_) {
+        err = "cannot open " + path;
+        return false;
+    }
+    FileHeader h;
+    if (std::fread(&h, sizeof(h), 1, fp_) != 1 || !ValidHeader(h)) {
+        Close();
+        err = path + ": bad magic or unsupported version";
+        return false;
+    }
+    for (uint32_t c = 0; c < h.column_count; ++c) {
+        ColumnSchema s;
+        if (std::fread(&s, sizeof(s), 1, fp_) != 1 || !ParseColumn(s, columns_)) {
+            Close();
+            err = path + ": truncated or invalid schema";
+            return false;
+        }
+    }
+    offsets_.resize(columns_.size());
+    chunk_rows_ = h.chunk_rows;
+    return true;
+}
+
+void StreamReader::Close()
+{
+    if (fp_) std::fclose(fp_);
+    fp_ = nullptr;
+    columns_.clear();
+    payload_.clear();
+    offsets_.clear();
+    chunk_rows_ = 0;
+    rows_ = 0;
+    err_.clear();
+}
+
+int StreamReader::FindColumn(const std::string& name) const { return FindColumnIn(columns_, name); }
+
+bool StreamReader::NextChunk()
+{
+    rows_ = 0;
+    if (!fp_) return false;
+
+    ChunkHeader ch;
+    if (std::fread(&ch, sizeof(ch), 1, fp_) != 1 ||
+        std::memcmp(ch.magic, kChunkMagic, sizeof(ch.magic)) != 0) {
+        return false;
+    }
+    // A writer never exceeds its chunk capacity; bound the row count before it sizes the buffer
+    if (ch.rows > chunk_rows_) {
+        err_ = "corrupt chunk header";
+        return false;
+    }
+    std::size_t off = 0;
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        offsets_[c] = off;
+        off += Padded(ch.rows * TypeSize(columns_[c].type));
+    }
+    if (off != ch.payload_bytes) {
+        err_ = "corrupt chunk header";
+        return false;
+    }
+
+    // Grows to the largest chunk once, then is reused
+    payload_.resize(off / sizeof(uint64_t));
+    if (std::fread(payload_.data(), 1, off, fp_) != off) return false;
+    rows_ = ch.rows;
+    return true;
+}
+
+bool IsColumnarLog(const std::string& path)
+{
+    std::FILE* fp = std::fopen(path.c_str(), "rb");
+    if (!fp) return false;
+    FileHeader h{};
+    const bool ok = std::fread(&h, sizeof(h), 1, fp) == 1 && ValidHeader(h);
+    std::fclose(fp);
+    return ok;
+}
+
+} // namespace Bsw::ColumnarLog
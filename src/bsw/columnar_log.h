@@ -0,0 +1,201 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Chunked columnar log file ("SDVCLOG1"), native little-endian:
+//
+//   FileHeader
+//   ColumnSchema[column_count]
+//   { ChunkHeader, column 0 values, column 1 values, ... }*
+//
+// Inside a chunk every column is one contiguous array of `rows` values,
+// padded to 8 bytes, so a mapped file can be read without copying. A file
+// cut short by a crash is readable up to its last complete chunk.
+namespace Bsw::ColumnarLog {
+
+enum class ColumnType : uint8_t {
+    F32 = 1,
+    U8 = 2
+};
+
+constexpr std::size_t TypeSize(ColumnType t) { return t == ColumnType::F32 ? 4 : 1; }
+
+// Maps one member of a row struct to a column
+struct ColumnDesc {
+    const char* name;
+    ColumnType type;
+    std::size_t offset; // offsetof(Row, member)
+};
+
+constexpr char kFileMagic[8] = {'S', 'D', 'V', 'C', 'L', 'O', 'G', '1'};
+constexpr char kChunkMagic[4] = {'C', 'H', 'N', 'K'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kDefaultChunkRows = 4096;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t column_count;
+    uint32_t chunk_rows; // capacity; the last chunk may hold fewer
+    uint32_t reserved;
+};
+
+struct ColumnSchema {
+    char name[31]; // NUL terminated
+    ColumnType type;
+};
+
+struct ChunkHeader {
+    char magic[4];
+    uint32_t rows;
+    uint64_t payload_bytes; // bytes of column data following this header
+};
+
+static_assert(sizeof(FileHeader) == 24 && sizeof(ColumnSchema) == 32 && sizeof(ChunkHeader) == 16,
+              "on-disk layout");
+
+/**
+ * @brief Buffers rows column-wise and writes one chunk every chunk_rows rows
+ *
+ * Not thread safe; Bsw::Logging calls it from exactly one thread.
+ */
+class Writer {
+public:
+    Writer() = default;
+    ~Writer() { Close(); }
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    // Takes ownership of fp (closed by Close()).
+    void Open(std::FILE* fp, const std::vector<ColumnDesc>& columns,
+              uint32_t chunk_rows = kDefaultChunkRows);
+    void Append(const void* row);
+    void Flush(); // writes the pending partial chunk, if any
+    void Close();
+
+    bool IsOpen() const { return fp_ != nullptr; }
+
+private:
+    void WriteChunk();
+
+    std::FILE* fp_ = nullptr;
+    std::vector<ColumnDesc> columns_;
+    std::vector<std::vector<uint8_t>> buffers_; // one per column
+    uint32_t chunk_rows_ = kDefaultChunkRows;
+    uint32_t rows_ = 0;
+};
+
+// Read-only view of contiguous column values (C++17 stand-in for std::span)
+template <typename T>
+struct Span {
+    const T* data = nullptr;
+    std::size_t size = 0;
+
+    const T& operator[](std::size_t i) const { return data[i]; }
+    const T* begin() const { return data; }
+    const T* end() const { return data + size; }
+};
+
+struct ColumnInfo {
+    std::string name;
+    ColumnType type;
+};
+
+/**
+ * @brief mmap-based reader; column spans point straight into the mapping
+ *
+ * Spans stay valid until Close() or destruction.
+ */
+class Reader {
+public:
+    Reader() = default;
+    ~Reader() { Close(); }
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    bool Open(const std::string& path, std::string& err);
+    void Close();
+
+    std::size_t ColumnCount() const { return columns_.size(); }
+    const ColumnInfo& Column(std::size_t col) const { return columns_[col]; }
+    // Column index by name, or -1
+    int FindColumn(const std::string& name) const;
+
+    std::size_t ChunkCount() const { return chunks_.size(); }
+    std::size_t ChunkRows(std::size_t chunk) const { return chunks_[chunk].rows; }
+    std::size_t RowCount() const { return row_count_; }
+
+    // T must match the column type (float for F32, uint8_t for U8), else an empty span.
+    template <typename T>
+    Span<T> ColumnSpan(std::size_t chunk, std::size_t col) const
+    {
+        const auto want = sizeof(T) == 4 ? ColumnType::F32 : ColumnType::U8;
+        if (columns_[col].type != want || sizeof(T) != TypeSize(want)) return {};
+        const auto& c = chunks_[chunk];
+        return Span<T>{reinterpret_cast<const T*>(c.columns[col]), c.rows};
+    }
+
+private:
+    struct Chunk {
+        std::size_t rows = 0;
+        std::vector<const uint8_t*> columns;
+    };
+
+    const uint8_t* map_ = nullptr;
+    std::size_t map_size_ = 0;
+    std::vector<ColumnInfo> columns_;
+    std::vector<Chunk> chunks_;
+    std::size_t row_count_ = 0;
+};
+
+/**
+ * @brief Sequential chunk-at-a-time reader (constant memory, any file length)
+ *
+ * Spans returned by ColumnSpan() are valid until the next NextChunk().
+ */
+class StreamReader {
+public:
+    StreamReader() = default;
+    ~StreamReader() { Close(); }
+    StreamReader(const StreamReader&) = delete;
+    StreamReader& operator=(const StreamReader&) = delete;
+
+    bool Open(const std::string& path, std::string& err);
+    void Close();
+
+    std::size_t ColumnCount() const { return columns_.size(); }
+    const ColumnInfo& Column(std::size_t col) const { return columns_[col]; }
+    int FindColumn(const std::string& name) const;
+
+    // Loads the next complete chunk; false at end of file, a truncated tail or
+    // a corrupt chunk header (Error() tells which)
+    bool NextChunk();
+    std::size_t Rows() const { return rows_; }
+    const std::string& Error() const { return err_; }
+
+    template <typename T>
+    Span<T> ColumnSpan(std::size_t col) const
+    {
+        const auto want = sizeof(T) == 4 ? ColumnType::F32 : ColumnType::U8;
+        if (columns_[col].type != want || sizeof(T) != TypeSize(want)) return {};
+        const auto* base = reinterpret_cast<const uint8_t*>(payload_.data());
+        return Span<T>{reinterpret_cast<const T*>(base + offsets_[col]), rows_};
+    }
+
+private:
+    std::FILE* fp_ = nullptr;
+    std::vector<ColumnInfo> columns_;
+    std::vector<uint64_t> payload_; // uint64_t keeps every column 8-byte aligned
+    std::vector<std::size_t> offsets_;
+    uint32_t chunk_rows_ = 0;
+    std::size_t rows_ = 0;
+    std::string err_;
+};
+
+// True if the file starts with the columnar log magic
+bool IsColumnarLog(const std::string& path);
+
+} // namespace Bsw::ColumnarLog
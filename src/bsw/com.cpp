@@ -0,0 +1,279 @@
+#include "bsw/com.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Bsw::Com {
+
+namespace {
+
+bool ProcessAlive(int32_t pid)
+{
+    return pid > 0 && (::kill(pid, 0) == 0 || errno == EPERM);
+}
+
+// Lock object serialising Create for a segment name: "/sdv_com" -> "/sdv_com.lock".
+// Never unlinked, so every ECU locks the same inode.
+std::string LockName(const std::string& name) { return name + ".lock"; }
+
+// Creator recorded in an existing Com segment of this version (for messages only), 0 if none
+int32_t SegmentOwner(const std::string& name)
+{
+    const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) return 0;
+    struct stat st {};
+    void* p = MAP_FAILED;
+    if (::fstat(fd, &st) == 0 && static_cast<uint64_t>(st.st_size) >= sizeof(SegmentHeader)) {
+        p = ::mmap(nullptr, sizeof(SegmentHeader), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (p == MAP_FAILED) return 0;
+    const auto* h = static_cast<const SegmentHeader*>(p);
+    const int32_t pid = std::memcmp(h->magic, kMagic, sizeof(h->magic)) == 0 && h->version == kVersion
+                            ? h->ecu_pid.load(std::memory_order_acquire)
+                            : 0;
+    ::munmap(p, sizeof(SegmentHeader));
+    return pid;
+}
+
+} // namespace
+
+bool Segment::Create(const std::string& name, std::string& err)
+{
+    Close();
+    // Never take over the segment of an ECU that is still running. The lock is
+    // held until Close() and dropped by the kernel if the ECU dies, so a crashed
+    // ECU never blocks the next one and no (possibly reused) pid is trusted.
+    const std::string lock_name = LockName(name);
+    const int lock = ::shm_open(lock_name.c_str(), O_CREAT | O_RDWR, 0600);
+    if (lock < 0) {
+        err = "cannot open shared memory lock " + lock_name + ": " + std::strerror(errno);
+        return false;
+    }
+    if (::flock(lock, LOCK_EX | LOCK_NB) != 0) {
+        const int e = errno;
+        ::close(lock);
+        if (e != EWOULDBLOCK) {
+            err = "cannot lock " + lock_name + ": " + std::strerror(e);
+            return false;
+        }
+        const int32_t owner = SegmentOwner(name);
+        err = "shared memory " + name + " in use by " +
+              (owner > 0 ? "pid " + std::to_string(owner) : std::string("another ECU"));
+        return false;
+    }
+    // A fresh object every time: processes still mapping a previous ECU's
+    // segment keep their (now orphaned) copy instead of seeing rings reset under them.
+    ::shm_unlink(name.c_str());
+    const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0 || ::ftruncate(fd, static_cast<off_t>(sizeof(Layout))) != 0) {
+        err = "cannot create shared memory " + name + ": " + std::strerror(errno);
+        if (fd >= 0) {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+        }
+        ::close(lock);
+        return false;
+    }
+    if (!Map(fd, name, err)) {
+        ::shm_unlink(name.c_str());
+        ::close(lock);
+        return false;
+    }
+    lock_fd_ = lock;
+    new (layout_) Layout();
+    SegmentHeader& h = layout_->header;
+    std::memcpy(h.magic, kMagic, sizeof(h.magic));
+    h.version = kVersion;
+    h.ring_slots = kRingSlots;
+    h.layout_bytes = sizeof(Layout);
+    h.input_pid.store(0, std::memory_order_relaxed);
+    h.ecu_pid.store(static_cast<int32_t>(::getpid()), std::memory_order_release);
+    owner_ = true;
+    return true;
+}
+
+bool Segment::Attach(const std::string& name, std::string& err)
+{
+    Close();
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        err = "cannot open shared memory " + name + ": " + std::strerror(errno);
+        return false;
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < sizeof(Layout)) {
+        ::close(fd);
+        err = name + ": segment too small (not created by this build?)";
+        return false;
+    }
+    if (!Map(fd, name, err)) return false;
+    const SegmentHeader& h = layout_->header;
+    if (std::memcmp(h.magic, kMagic, sizeof(h.magic)) != 0 || h.version != kVersion ||
+        h.ring_slots != kRingSlots || h.layout_bytes != sizeof(Layout)) {
+        Close();
+        err = name + ": not a Com segment of this version";
+        return false;
+    }
+    return true;
+}
+
+bool Segment::Map(int fd, const std::string& name, std::string& err)
+{
+    void* p = ::mmap(nullptr, sizeof(Layout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        err = "cannot map shared memory " + name + ": " + std::strerror(errno);
+        return false;
+    }
+    layout_ = static_cast<Layout*>(p);
+    name_ = name;
+    return true;
+}
+
+bool Segment::ClaimInput(std::string& err)
+{
+    if (!layout_) {
+        err = "segment not open";
+        return false;
+    }
+    const auto me = static_cast<int32_t>(::getpid());
+    auto& owner = layout_->header.input_pid;
+    int32_t cur = owner.load(std::memory_order_acquire);
+    for (;;) {
+        if (cur == me) break;
+        if (cur != 0 && ProcessAlive(cur)) {
+            err = "input already claimed by pid " + std::to_string(cur);
+            return false;
+        }
+        if (owner.compare_exchange_weak(cur, me, std::memory_order_acq_rel)) break;
+    }
+    input_claimed_ = true;
+    return true;
+}
+
+void Segment::Close()
+{
+    if (!layout_) return;
+    if (input_claimed_) {
+        int32_t me = static_cast<int32_t>(::getpid());
+        layout_->header.input_pid.compare_exchange_strong(me, 0, std::memory_order_acq_rel);
+    }
+    ::munmap(layout_, sizeof(Layout));
+    if (owner_) ::shm_unlink(name_.c_str());
+    if (lock_fd_ >= 0) ::close(lock_fd_); // after the unlink: the next ECU may create the name now
+    lock_fd_ = -1;
+    layout_ = nullptr;
+    name_.clear();
+    owner_ = false;
+    input_claimed_ = false;
+}
+
+// ---- ECU side ----
+
+namespace {
+
+constexpr uint64_t kNever = UINT64_MAX; // forces a publication at the first tick
+
+Segment g_segment;
+UdpGateway g_udp;
+uint64_t g_seq_driver_input = kNever;
+uint64_t g_seq_actuator_cmd = kNever;
+uint64_t g_seq_vehicle_state = kNever;
+uint64_t g_seq_safety = kNever;
+uint64_t g_last_input = kNever;
+std::atomic<uint64_t> g_published{0};
+std::atomic<uint64_t> g_input_samples{0};
+
+// Publishes read() when the port's sequence number moved since the last tick
+template <typename T, typename Read>
+void PublishIfChanged(ShmRing<T>& ring, uint32_t seq, uint64_t& last, int64_t now, Read read)
+{
+    if (seq == last) return;
+    last = seq;
+    ring.Publish(read(), now);
+    g_published.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace
+
+bool Init(const std::string& name, std::string& err)
+{
+    g_segment.Close();
+    if (!g_segment.Create(name, err)) return false;
+    g_seq_driver_input = g_seq_actuator_cmd = g_seq_vehicle_state = g_seq_safety = kNever;
+    g_last_input = kNever;
+    g_published.store(0, std::memory_order_relaxed);
+    g_input_samples.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+bool InitUdp(const UdpConfig& cfg, std::string& err) { return g_udp.Open(cfg, err); }
+
+void Shutdown()
+{
+    g_segment.Close();
+    g_udp.Close();
+}
+
+bool IsActive() { return g_segment.IsOpen() || g_udp.IsOpen(); }
+
+void Tick10ms(const Rte::Context& ctx)
+{
+    g_udp.Tick10ms(ctx);
+    if (!g_segment.IsOpen()) return;
+    Layout& l = *g_segment;
+    const int64_t now = NowNs();
+    PublishIfChanged(l.driver_input, Rte::Rte_Seq_DriverInput(ctx), g_seq_driver_input, now,
+                     [&] { return Rte::Rte_Read_DriverInput(ctx); });
+    PublishIfChanged(l.actuator_cmd, Rte::Rte_Seq_ActuatorCmd(ctx), g_seq_actuator_cmd, now,
+                     [&] { return Rte::Rte_Read_ActuatorCmd(ctx); });
+    PublishIfChanged(l.vehicle_state, Rte::Rte_Seq_VehicleState(ctx), g_seq_vehicle_state, now,
+                     [&] { return Rte::Rte_Read_VehicleState(ctx); });
+    PublishIfChanged(l.safety, Rte::Rte_Seq_Safety(ctx), g_seq_safety, now,
+                     [&] { return Rte::Rte_Read_Safety(ctx); });
+}
+
+bool LatestInput(Sample<Rte::DriverInput>& out)
+{
+    if (!g_segment.IsOpen() || !g_segment->input.Latest(out)) return false;
+    if (out.seq != g_last_input) {
+        g_last_input = out.seq;
+        g_input_samples.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+bool PollUdpInput(Sample<Rte::DriverInput>& out)
+{
+    if (!g_udp.IsOpen()) return false;
+    g_udp.Poll();
+    uint16_t cycle = 0;
+    if (!g_udp.LatestInput(out.value, cycle, out.stamp_ns)) return false;
+    out.seq = cycle;
+    return true;
+}
+
+Stats GetStats()
+{
+    Stats s;
+    s.published = g_published.load(std::memory_order_relaxed);
+    s.input_samples = g_input_samples.load(std::memory_order_relaxed);
+    return s;
+}
+
+UdpStats GetUdpStats() { return g_udp.Stats(); }
+
+uint16_t UdpLocalPort() { return g_udp.LocalPort(); }
+
+} // namespace Bsw::Com
@@ -0,0 +1,264 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "bsw/com_udp.h"
+#include "rte/rte.h"
+
+// Com: RTE signals shared with other local processes (HIL stand-in,
+// visualisation) through one POSIX shared-memory segment.
+//
+// Every signal is a single-producer broadcast ring of seqlock slots in the
+// segment. The producer never waits, whatever its consumers do; a consumer
+// reads straight out of the mapping (no socket, no kernel copy) and keeps
+// its own cursor, so any number of processes can subscribe. A consumer that
+// falls more than kRingSlots behind loses the oldest samples and is told so.
+//
+//   ECU (sdv_sim --com)  -> driver_input, actuator_cmd, vehicle_state, safety
+//   one input producer   -> input (DriverInput injected into the ECU)
+//
+// Peers that cannot map the segment (a driving station in its own runtime)
+// use the UDP gateway of bsw/com_udp.h instead; both hang off the same tick.
+namespace Bsw::Com {
+
+constexpr char kDefaultName[] = "/sdv_com";
+constexpr char kMagic[8] = {'S', 'D', 'V', 'C', 'O', 'M', '0', '1'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kRingSlots = 256; // 2.56 s of 10ms samples
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<int32_t>::is_always_lock_free,
+              "cross-process atomics must be lock free");
+
+// Monotonic clock shared by all processes of the host (CLOCK_MONOTONIC)
+inline int64_t NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+template <typename T>
+struct Sample {
+    uint64_t seq = 0;     // 0-based publication index in the ring
+    int64_t stamp_ns = 0; // producer's NowNs() (or any stamp it chose) at Publish
+    T value{};
+};
+
+/**
+ * @brief Single-producer broadcast ring living in shared memory
+ *
+ * Publish() claims slot head % N, makes its state odd, stores the payload
+ * and then state = 2 * seq + 2, like Rte::SeqlockPort. A reader accepts the
+ * slot only if the state names exactly the sequence it asked for and did not
+ * change while copying, so a sample being overwritten is never returned torn.
+ * Payload words are relaxed atomics (no data race under the memory model).
+ *
+ * @note Only one thread of one process may Publish() at a time.
+ */
+template <typename T, uint32_t N = kRingSlots>
+class ShmRing {
+    static_assert(std::is_trivially_copyable_v<T>, "ShmRing payload must be trivially copyable");
+    static_assert(N > 0 && (N & (N - 1)) == 0, "slot count must be a power of two");
+
+public:
+    static constexpr uint32_t kSlots = N;
+
+    void Publish(const T& v, int64_t stamp_ns = NowNs()) noexcept
+    {
+        uint64_t buf[kWords] = {};
+        std::memcpy(buf, &v, sizeof(T));
+
+        const uint64_t n = head_.load(std::memory_order_relaxed);
+        Slot& s = slots_[n & (N - 1)];
+        s.state.store(2 * n + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        s.stamp_ns.store(stamp_ns, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < kWords; ++i) s.words[i].store(buf[i], std::memory_order_relaxed);
+        s.state.store(2 * n + 2, std::memory_order_release);
+        head_.store(n + 1, std::memory_order_release);
+    }
+
+    // Number of samples published so far
+    uint64_t Published() const noexcept { return head_.load(std::memory_order_acquire); }
+
+    // Sample seq, or false if it is not published yet or already overwritten
+    bool Read(uint64_t seq, Sample<T>& out) const noexcept
+    {
+        const Slot& s = slots_[seq & (N - 1)];
+        const uint64_t want = 2 * seq + 2;
+        if (s.state.load(std::memory_order_acquire) != want) return false;
+        uint64_t buf[kWords];
+        const int64_t stamp = s.stamp_ns.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < kWords; ++i) buf[i] = s.words[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (s.state.load(std::memory_order_relaxed) != want) return false;
+        out.seq = seq;
+        out.stamp_ns = stamp;
+        std::memcpy(&out.value, buf, sizeof(T));
+        return true;
+    }
+
+    // Most recent sample; false if nothing was published yet
+    bool Latest(Sample<T>& out) const noexcept
+    {
+        for (;;) {
+            const uint64_t h = Published();
+            if (h == 0) return false;
+            if (Read(h - 1, out)) return true; // else lapped while reading: retry with the new head
+        }
+    }
+
+private:
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct alignas(Rte::kCacheLineSize) Slot {
+        std::atomic<uint64_t> state{0}; // 2 * seq + 2 when slot holds seq, odd while written
+        std::atomic<int64_t> stamp_ns{0};
+        std::array<std::atomic<uint64_t>, kWords> words{};
+    };
+
+    alignas(Rte::kCacheLineSize) std::atomic<uint64_t> head_{0};
+    Slot slots_[N];
+};
+
+/**
+ * @brief Process-local read cursor on a ShmRing
+ *
+ * Next() returns every sample in publication order; if the producer lapped
+ * the cursor, the overwritten samples are skipped and counted in Lost().
+ */
+template <typename T, uint32_t N = kRingSlots>
+class Subscriber {
+public:
+    Subscriber() = default;
+    // from_start = false: only samples published after construction
+    explicit Subscriber(const ShmRing<T, N>& ring, bool from_start = false)
+        : ring_(&ring), next_(from_start ? 0 : ring.Published())
+    {
+    }
+
+    bool Next(Sample<T>& out) noexcept
+    {
+        if (!ring_) return false;
+        for (;;) {
+            const uint64_t h = ring_->Published();
+            if (next_ >= h) return false;
+            if (h - next_ > N) { // lapped: the oldest we can still get is h - N
+                lost_ += h - N - next_;
+                next_ = h - N;
+            }
+            if (ring_->Read(next_, out)) {
+                ++next_;
+                return true;
+            }
+            ++lost_; // overwritten while we looked
+            ++next_;
+        }
+    }
+
+    // Skip to the newest sample (returns it), dropping the backlog without counting it as lost
+    bool Latest(Sample<T>& out) noexcept
+    {
+        if (!ring_ || !ring_->Latest(out)) return false;
+        next_ = out.seq + 1;
+        return true;
+    }
+
+    uint64_t Lost() const { return lost_; }
+
+private:
+    const ShmRing<T, N>* ring_ = nullptr;
+    uint64_t next_ = 0;
+    uint64_t lost_ = 0;
+};
+
+struct alignas(Rte::kCacheLineSize) SegmentHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t ring_slots;
+    uint64_t layout_bytes;             // sizeof(Layout) of the creator: catches ABI mismatches
+    std::atomic<int32_t> ecu_pid;      // creator
+    std::atomic<int32_t> input_pid;    // process holding the input ring, 0 if none
+};
+
+// Segment contents, created in place by Segment::Create
+struct Layout {
+    SegmentHeader header;
+    ShmRing<Rte::DriverInput> input;         // injected by the input producer, read by the ECU
+    ShmRing<Rte::DriverInput> driver_input;  // applied by the ECU (after clamping / fallback)
+    ShmRing<Rte::ActuatorCmd> actuator_cmd;
+    ShmRing<Rte::VehicleState> vehicle_state;
+    ShmRing<Rte::Safety> safety;
+};
+
+/**
+ * @brief Mapping of one Com segment (shm_open + mmap)
+ *
+ * The ECU Create()s the segment under an exclusive flock on NAME.lock, held
+ * until Close() (the kernel drops it if the ECU dies): a second live ECU is
+ * refused, a crashed one's segment is replaced, and two ECUs starting at
+ * once cannot unlink each other's fresh segment. Other processes
+ * Attach() to it and validate magic, version and layout size. A process that
+ * wants to inject DriverInput must ClaimInput() first, which keeps the input
+ * ring single-producer across processes (a claim held by a dead process is
+ * taken over). Close() releases the claim; the creator also unlinks the name.
+ */
+class Segment {
+public:
+    Segment() = default;
+    ~Segment() { Close(); }
+    Segment(const Segment&) = delete;
+    Segment& operator=(const Segment&) = delete;
+
+    bool Create(const std::string& name, std::string& err);
+    bool Attach(const std::string& name, std::string& err);
+    void Close();
+
+    bool ClaimInput(std::string& err);
+
+    bool IsOpen() const { return layout_ != nullptr; }
+    Layout& operator*() const { return *layout_; }
+    Layout* operator->() const { return layout_; }
+
+private:
+    bool Map(int fd, const std::string& name, std::string& err);
+
+    Layout* layout_ = nullptr;
+    std::string name_;
+    bool owner_ = false;
+    bool input_claimed_ = false;
+    int lock_fd_ = -1; // creator: flock on the NAME.lock object
+};
+
+struct Stats {
+    uint64_t published = 0;    // samples written to the four output rings
+    uint64_t input_samples = 0; // injected DriverInput samples taken by LatestInput
+};
+
+// ECU side, process-wide like Bsw::Logging: Init creates the segment,
+// InitUdp opens the UDP gateway, and Tick10ms publishes (or packs) each
+// signal of the instance whose RTE sequence number changed since the last
+// tick. Without either, Tick10ms does nothing. Shutdown closes both.
+bool Init(const std::string& name, std::string& err);
+bool InitUdp(const UdpConfig& cfg, std::string& err);
+void Shutdown();
+bool IsActive();
+void Tick10ms(const Rte::Context& ctx);
+
+// Newest injected DriverInput; false if none was published yet
+bool LatestInput(Sample<Rte::DriverInput>& out);
+// Drains the gateway socket, then the same for DriverInput received over UDP
+// (seq = PDU cycle counter, stamp_ns = arrival time)
+bool PollUdpInput(Sample<Rte::DriverInput>& out);
+
+Stats GetStats();
+UdpStats GetUdpStats();
+uint16_t UdpLocalPort(); // 0 if the gateway is not open
+
+} // namespace Bsw::Com
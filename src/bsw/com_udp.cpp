@@ -0,0 +1,501 @@
+#include "bsw/com_udp.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "bsw/com.h"
+
+namespace Bsw::Com {
+
+namespace {
+
+constexpr std::size_t kDriverInputBytes = 12;
+constexpr std::size_t kActuatorCmdBytes = 12;
+constexpr std::size_t kVehicleStateBytes = 28;
+constexpr std::size_t kSafetyBytes = 2;
+
+void PutU16(uint8_t* p, uint16_t v)
+{
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+void PutU32(uint8_t* p, uint32_t v)
+{
+    for (int i = 0; i < 4; ++i) p[i] = static_cast<uint8_t>(v >> (8 * i));
+}
+
+void PutU64(uint8_t* p, uint64_t v)
+{
+    for (int i = 0; i < 8; ++i) p[i] = static_cast<uint8_t>(v >> (8 * i));
+}
+
+uint8_t* PutF32(uint8_t* p, float f)
+{
+    uint32_t v;
+    std::memcpy(&v, &f, sizeof(v));
+    PutU32(p, v);
+    return p + 4;
+}
+
+uint16_t GetU16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | p[1] << 8); }
+
+uint32_t GetU32(const uint8_t* p)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) v |= static_cast<uint32_t>(p[i]) << (8 * i);
+    return v;
+}
+
+uint64_t GetU64(const uint8_t* p)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < 8; ++i) v |= static_cast<uint64_t>(p[i]) << (8 * i);
+    return v;
+}
+
+const uint8_t* GetF32(const uint8_t* p, float& f)
+{
+    const uint32_t v = GetU32(p);
+    std::memcpy(&f, &v, sizeof(f));
+    return p + 4;
+}
+
+std::size_t PayloadBytes(PduId id)
+{
+    switch (id) {
+    case PduId::DriverInput: return kDriverInputBytes;
+    case PduId::ActuatorCmd: return kActuatorCmdBytes;
+    case PduId::VehicleState: return kVehicleStateBytes;
+    case PduId::Safety: return kSafetyBytes;
+    }
+    return 0;
+}
+
+// Packed peer: 1 << 48 | IPv4 address << 16 | port, both in network order
+uint64_t PackPeer(const sockaddr_in& a)
+{
+    return uint64_t{1} << 48 | static_cast<uint64_t>(a.sin_addr.s_addr) << 16 | a.sin_port;
+}
+
+sockaddr_in UnpackPeer(uint64_t p)
+{
+    sockaddr_in a{};
+    a.sin_family = AF_INET;
+    a.sin_port = static_cast<in_port_t>(p & 0xffff);
+    a.sin_addr.s_addr = static_cast<in_addr_t>(p >> 16);
+    return a;
+}
+
+sockaddr_in Loopback(uint16_t port)
+{
+    sockaddr_in a{};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(port);
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return a;
+}
+
+} // namespace
+
+// ---- PDU codec ----
+
+uint32_t NewSession()
+{
+    const auto ms = static_cast<uint32_t>(NowNs() / 1000000);
+    return ms != 0 ? ms : 1;
+}
+
+void DatagramBuilder::StartDatagram()
+{
+    if (buffers_.size() == count_) {
+        buffers_.emplace_back();
+        buffers_.back().reserve(kMaxDatagramBytes);
+    }
+    buffers_[count_].assign(kDatagramHeaderBytes, 0);
+    ++count_;
+}
+
+uint8_t* DatagramBuilder::Reserve(PduId id, uint16_t cycle, std::size_t payload_bytes)
+{
+    const std::size_t pdu_bytes = kPduHeaderBytes + payload_bytes;
+    if (count_ == 0 || buffers_[count_ - 1].size() + pdu_bytes > kMaxDatagramBytes ||
+        buffers_[count_ - 1][3] == kMaxPdusPerDatagram) {
+        StartDatagram();
+    }
+    std::vector<uint8_t>& d = buffers_[count_ - 1];
+    const std::size_t at = d.size();
+    d.resize(at + pdu_bytes);
+    ++d[3];
+    ++pdus_;
+    uint8_t* p = d.data() + at;
+    p[0] = static_cast<uint8_t>(id);
+    p[1] = static_cast<uint8_t>(payload_bytes);
+    PutU16(p + 2, cycle);
+    return p + kPduHeaderBytes;
+}
+
+void DatagramBuilder::Add(uint16_t cycle, const Rte::DriverInput& v)
+{
+    uint8_t* p = Reserve(PduId::DriverInput, cycle, kDriverInputBytes);
+    p = PutF32(p, v.throttle);
+    p = PutF32(p, v.brake);
+    PutF32(p, v.steer);
+}
+
+void DatagramBuilder::Add(uint16_t cycle, const Rte::ActuatorCmd& v)
+{
+    uint8_t* p = Reserve(PduId::ActuatorCmd, cycle, kActuatorCmdBytes);
+    p = PutF32(p, v.drive_accel_cmd);
+    p = PutF32(p, v.brake_decel_cmd);
+    PutF32(p, v.steer_angle_cmd);
+}
+
+void DatagramBuilder::Add(uint16_t cycle, const Rte::VehicleState& v)
+{
+    uint8_t* p = Reserve(PduId::VehicleState, cycle, kVehicleStateBytes);
+    for (const float f : {v.t, v.x, v.y, v.yaw, v.v, v.yaw_rate, v.wheel_omega}) p = PutF32(p, f);
+}
+
+void DatagramBuilder::Add(uint16_t cycle, const Rte::Safety& v)
+{
+    uint8_t* p = Reserve(PduId::Safety, cycle, kSafetyBytes);
+    p[0] = v.estop ? 1 : 0;
+    p[1] = static_cast<uint8_t>(v.system_state);
+}
+
+void DatagramBuilder::Finish(uint32_t first_seq, int64_t stamp_ns)
+{
+    for (std::size_t i = 0; i < count_; ++i) {
+        uint8_t* h = buffers_[i].data();
+        h[0] = static_cast<uint8_t>(kPduMagic[0]);
+        h[1] = static_cast<uint8_t>(kPduMagic[1]);
+        h[2] = kPduVersion;
+        PutU32(h + 4, session_);
+        PutU32(h + 8, first_seq + static_cast<uint32_t>(i));
+        PutU64(h + 12, static_cast<uint64_t>(stamp_ns));
+    }
+}
+
+void DatagramBuilder::Clear()
+{
+    count_ = 0;
+    pdus_ = 0;
+}
+
+bool DecodeDatagram(const uint8_t* data, std::size_t size, PduBatch& out)
+{
+    if (size < kDatagramHeaderBytes || data[0] != static_cast<uint8_t>(kPduMagic[0]) ||
+        data[1] != static_cast<uint8_t>(kPduMagic[1]) || data[2] != kPduVersion) {
+        return false;
+    }
+    const std::size_t count = data[3];
+    std::size_t at = kDatagramHeaderBytes;
+    // Validate the framing first so a bad datagram leaves out untouched
+    for (std::size_t i = 0; i < count; ++i) {
+        if (size - at < kPduHeaderBytes) return false;
+        const std::size_t len = data[at + 1];
+        const std::size_t expected = PayloadBytes(static_cast<PduId>(data[at]));
+        if ((expected != 0 && len != expected) || size - at - kPduHeaderBytes < len) return false;
+        at += kPduHeaderBytes + len;
+    }
+    if (at != size) return false;
+
+    out.session = GetU32(data + 4);
+    out.seq = GetU32(data + 8);
+    out.stamp_ns = static_cast<int64_t>(GetU64(data + 12));
+    out.pdus.clear();
+    at = kDatagramHeaderBytes;
+    for (std::size_t i = 0; i < count; ++i) {
+        const uint8_t* p = data + at;
+        const std::size_t len = p[1];
+        at += kPduHeaderBytes + len;
+        const auto id = static_cast<PduId>(p[0]);
+        if (PayloadBytes(id) == 0) continue; // newer sender: skip what we do not know
+        PduBatch::Entry e{};
+        e.id = id;
+        e.cycle = GetU16(p + 2);
+        p += kPduHeaderBytes;
+        switch (id) {
+        case PduId::DriverInput:
+            p = GetF32(p, e.driver_input.throttle);
+            p = GetF32(p, e.driver_input.brake);
+            GetF32(p, e.driver_input.steer);
+            break;
+        case PduId::ActuatorCmd:
+            p = GetF32(p, e.actuator_cmd.drive_accel_cmd);
+            p = GetF32(p, e.actuator_cmd.brake_decel_cmd);
+            GetF32(p, e.actuator_cmd.steer_angle_cmd);
+            break;
+        case PduId::VehicleState:
+            for (float* f : {&e.vehicle_state.t, &e.vehicle_state.x, &e.vehicle_state.y, &e.vehicle_state.yaw,
+                             &e.vehicle_state.v, &e.vehicle_state.yaw_rate, &e.vehicle_state.wheel_omega}) {
+                p = GetF32(p, *f);
+            }
+            break;
+        case PduId::Safety:
+            e.safety.estop = p[0] != 0;
+            e.safety.system_state = p[1] <= static_cast<uint8_t>(Rte::SystemState::EStop)
+                                        ? static_cast<Rte::SystemState>(p[1])
+                                        : Rte::SystemState::EStop;
+            break;
+        }
+        out.pdus.push_back(e);
+    }
+    return true;
+}
+
+// ---- Socket ----
+
+bool UdpSocket::Open(uint16_t bind_port, std::string& err)
+{
+    Close();
+    const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        err = std::string("cannot create UDP socket: ") + std::strerror(errno);
+        return false;
+    }
+    // Room for a few hundred ms of traffic if a side stalls
+    const int buf_bytes = 1 << 20;
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &buf_bytes, sizeof(buf_bytes));
+    ::setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &buf_bytes, sizeof(buf_bytes));
+    sockaddr_in a = Loopback(bind_port);
+    socklen_t len = sizeof(a);
+    if (::bind(fd, reinterpret_cast<const sockaddr*>(&a), sizeof(a)) != 0 ||
+        ::getsockname(fd, reinterpret_cast<sockaddr*>(&a), &len) != 0) {
+        err = "cannot bind UDP 127.0.0.1:" + std::to_string(bind_port) + ": " + std::strerror(errno);
+        ::close(fd);
+        return false;
+    }
+    fd_ = fd;
+    local_port_ = ntohs(a.sin_port);
+    return true;
+}
+
+void UdpSocket::Close()
+{
+    if (fd_ >= 0) ::close(fd_);
+    fd_ = -1;
+    local_port_ = 0;
+    fixed_peer_ = false;
+    peer_.store(0, std::memory_order_relaxed);
+}
+
+void UdpSocket::SetPeer(uint16_t port)
+{
+    fixed_peer_ = true;
+    peer_.store(PackPeer(Loopback(port)), std::memory_order_release);
+}
+
+void UdpSocket::LearnPeer(uint64_t from)
+{
+    if (!fixed_peer_ && from != 0) peer_.store(from, std::memory_order_release);
+}
+
+std::size_t UdpSocket::Send(const DatagramBuilder& b)
+{
+    const uint64_t packed = peer_.load(std::memory_order_acquire);
+    if (fd_ < 0 || packed == 0) return 0;
+    sockaddr_in peer = UnpackPeer(packed);
+    std::size_t sent = 0;
+#if SDV_COM_HAVE_MMSG
+    std::array<mmsghdr, kSendBatch> msgs{};
+    std::array<iovec, kSendBatch> iov{};
+    while (sent < b.DatagramCount()) {
+        const std::size_t n = std::min(kSendBatch, b.DatagramCount() - sent);
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::vector<uint8_t>& d = b.Datagram(sent + i);
+            iov[i].iov_base = const_cast<uint8_t*>(d.data());
+            iov[i].iov_len = d.size();
+            msgs[i].msg_hdr = msghdr{};
+            msgs[i].msg_hdr.msg_name = &peer;
+            msgs[i].msg_hdr.msg_namelen = sizeof(peer);
+            msgs[i].msg_hdr.msg_iov = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+        ++send_calls_;
+        const int r = ::sendmmsg(fd_, msgs.data(), static_cast<unsigned>(n), 0);
+        if (r <= 0) break; // send buffer full (EAGAIN): the rest is dropped, as UDP would
+        sent += static_cast<std::size_t>(r);
+    }
+#else
+    for (; sent < b.DatagramCount(); ++sent) {
+        const std::vector<uint8_t>& d = b.Datagram(sent);
+        ++send_calls_;
+        if (::sendto(fd_, d.data(), d.size(), 0, reinterpret_cast<const sockaddr*>(&peer), sizeof(peer)) < 0) {
+            break;
+        }
+    }
+#endif
+    return sent;
+}
+
+std::size_t UdpSocket::Receive()
+{
+    if (fd_ < 0) return 0;
+    std::array<sockaddr_in, kRecvBatch> from{};
+    std::size_t n = 0;
+#if SDV_COM_HAVE_MMSG
+    std::array<mmsghdr, kRecvBatch> msgs{};
+    std::array<iovec, kRecvBatch> iov{};
+    for (std::size_t i = 0; i < kRecvBatch; ++i) {
+        iov[i].iov_base = rx_[i].data();
+        iov[i].iov_len = rx_[i].size();
+        msgs[i].msg_hdr.msg_name = &from[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(from[i]);
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    ++recv_calls_;
+    const int r = ::recvmmsg(fd_, msgs.data(), static_cast<unsigned>(kRecvBatch), MSG_DONTWAIT, nullptr);
+    if (r <= 0) return 0;
+    n = static_cast<std::size_t>(r);
+    for (std::size_t i = 0; i < n; ++i) {
+        rx_size_[i] = (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) ? 0 : msgs[i].msg_len;
+    }
+#else
+    for (; n < kRecvBatch; ++n) {
+        socklen_t len = sizeof(from[n]);
+        ++recv_calls_;
+        const ssize_t r = ::recvfrom(fd_, rx_[n].data(), rx_[n].size(), MSG_DONTWAIT | MSG_TRUNC,
+                                     reinterpret_cast<sockaddr*>(&from[n]), &len);
+        if (r < 0) break;
+        rx_size_[n] = static_cast<std::size_t>(r) > rx_[n].size() ? 0 : static_cast<std::size_t>(r);
+    }
+    if (n == 0) return 0;
+#endif
+    for (std::size_t i = 0; i < n; ++i) rx_from_[i] = PackPeer(from[i]);
+    return n;
+}
+
+bool UdpSocket::WaitReadable(int timeout_ms) const
+{
+    if (fd_ < 0) return false;
+    pollfd p{fd_, POLLIN, 0};
+    return ::poll(&p, 1, timeout_ms) > 0 && (p.revents & POLLIN);
+}
+
+// ---- ECU gateway ----
+
+bool UdpGateway::Open(const UdpConfig& cfg, std::string& err)
+{
+    Close();
+    if (!sock_.Open(cfg.bind_port, err)) return false;
+    if (cfg.peer_port != 0) sock_.SetPeer(cfg.peer_port);
+    cfg_ = cfg;
+    if (cfg_.batch_cycles == 0) cfg_.batch_cycles = 1;
+    tx_.SetSession(NewSession());
+    return true;
+}
+
+void UdpGateway::Close()
+{
+    if (sock_.IsOpen()) Flush(); // a partly filled --udp-batch batch
+    sock_.Close();
+    tx_.Clear();
+    cycle_ = 0;
+    tx_seq_ = 0;
+    batched_cycles_ = 0;
+    seq_driver_input_ = seq_actuator_cmd_ = seq_vehicle_state_ = seq_safety_ = UINT64_MAX;
+    have_input_ = false;
+    stats_ = UdpStats{};
+}
+
+void UdpGateway::Tick10ms(const Rte::Context& ctx)
+{
+    if (!sock_.IsOpen()) return;
+    const auto changed = [](uint32_t seq, uint64_t& last) {
+        if (seq == last) return false;
+        last = seq;
+        return true;
+    };
+    if (changed(Rte::Rte_Seq_DriverInput(ctx), seq_driver_input_)) tx_.Add(cycle_, Rte::Rte_Read_DriverInput(ctx));
+    if (changed(Rte::Rte_Seq_ActuatorCmd(ctx), seq_actuator_cmd_)) tx_.Add(cycle_, Rte::Rte_Read_ActuatorCmd(ctx));
+    if (changed(Rte::Rte_Seq_VehicleState(ctx), seq_vehicle_state_)) {
+        tx_.Add(cycle_, Rte::Rte_Read_VehicleState(ctx));
+    }
+    if (changed(Rte::Rte_Seq_Safety(ctx), seq_safety_)) tx_.Add(cycle_, Rte::Rte_Read_Safety(ctx));
+    ++cycle_;
+    if (++batched_cycles_ >= cfg_.batch_cycles) Flush();
+}
+
+void UdpGateway::Flush()
+{
+    batched_cycles_ = 0;
+    if (tx_.DatagramCount() == 0) return;
+    tx_.Finish(tx_seq_, NowNs());
+    tx_seq_ += static_cast<uint32_t>(tx_.DatagramCount());
+    const std::size_t sent = sock_.Send(tx_);
+    stats_.datagrams_tx += sent;
+    stats_.send_dropped += tx_.DatagramCount() - sent;
+    for (std::size_t i = 0; i < sent; ++i) stats_.pdus_tx += tx_.Datagram(i)[3];
+    tx_.Clear();
+}
+
+std::size_t UdpGateway::Poll()
+{
+    std::size_t total = 0;
+    for (;;) {
+        const std::size_t n = sock_.Receive();
+        const int64_t now = NowNs();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!DecodeDatagram(sock_.RxData(i), sock_.RxSize(i), batch_)) {
+                ++stats_.malformed;
+                continue;
+            }
+            stats_.pdus_rx += batch_.pdus.size();
+            bool accepted = false;
+            for (const PduBatch::Entry& e : batch_.pdus) {
+                if (e.id != PduId::DriverInput) continue;
+                // A newer session is a restarted sender whose counters started over
+                const bool restart = have_input_ && SessionNewer(batch_.session, input_session_);
+                if (have_input_ && !restart &&
+                    (batch_.session != input_session_ || !CycleNewer(e.cycle, input_cycle_))) {
+                    ++stats_.stale_inputs;
+                    continue;
+                }
+                if (restart) ++stats_.restarts;
+                have_input_ = true;
+                input_ = e.driver_input;
+                input_session_ = batch_.session;
+                input_cycle_ = e.cycle;
+                input_rx_ns_ = now;
+                ++stats_.inputs;
+                accepted = true;
+            }
+            if (accepted) sock_.LearnPeer(sock_.RxFrom(i));
+        }
+        stats_.datagrams_rx += n;
+        total += n;
+        if (n < UdpSocket::kRecvBatch) break;
+    }
+    return total;
+}
+
+bool UdpGateway::LatestInput(Rte::DriverInput& in, uint16_t& cycle, int64_t& rx_ns) const
+{
+    if (!have_input_) return false;
+    in = input_;
+    cycle = input_cycle_;
+    rx_ns = input_rx_ns_;
+    return true;
+}
+
+UdpStats UdpGateway::Stats() const
+{
+    UdpStats s = stats_;
+    s.send_calls = sock_.SendCalls();
+    s.recv_calls = sock_.RecvCalls();
+    return s;
+}
+
+} // namespace Bsw::Com
@@ -0,0 +1,239 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rte/rte.h"
+
+#ifndef SDV_COM_HAVE_MMSG
+#if defined(__linux__)
+#define SDV_COM_HAVE_MMSG 1 // sendmmsg/recvmmsg: many datagrams per system call
+#else
+#define SDV_COM_HAVE_MMSG 0 // one sendto/recvfrom per datagram
+#endif
+#endif
+
+// UDP signal gateway: RTE signals as compact binary PDUs (CAN-over-UDP style)
+// between the ECU and a driving-station process on the same host.
+//
+// Datagram, little-endian, no padding:
+//   header  magic "SU", version u8, pdu_count u8, session u32, datagram seq u32, stamp_ns i64 (sender NowNs)
+//   pdu*    id u8, length u8, cycle u16 (sender's 10ms cycle counter, wraps), payload
+// Payloads: DriverInput throttle/brake/steer f32 (12 B), ActuatorCmd 3 x f32,
+// VehicleState 7 x f32, Safety estop u8 + system_state u8. A datagram carries
+// any number of PDUs from any number of cycles; unknown ids are skipped by
+// length, so receivers tolerate newer senders. The session is fixed per sender
+// run (NewSession()); a newer one tells the receiver the sender restarted and
+// its counters started over.
+namespace Bsw::Com {
+
+enum class PduId : uint8_t {
+    DriverInput = 1,
+    ActuatorCmd = 2,
+    VehicleState = 3,
+    Safety = 4
+};
+
+constexpr char kPduMagic[2] = {'S', 'U'};
+constexpr uint8_t kPduVersion = 2;
+constexpr std::size_t kDatagramHeaderBytes = 20;
+constexpr std::size_t kPduHeaderBytes = 4;
+constexpr std::size_t kMaxDatagramBytes = 1400; // fits an Ethernet MTU if the gateway ever leaves loopback
+constexpr std::size_t kMaxPdusPerDatagram = 255;
+
+// Decoded contents of one datagram, in PDU order
+struct PduBatch {
+    uint32_t session = 0;
+    uint32_t seq = 0;
+    int64_t stamp_ns = 0;
+    struct Entry {
+        PduId id;
+        uint16_t cycle;
+        Rte::DriverInput driver_input;
+        Rte::ActuatorCmd actuator_cmd;
+        Rte::VehicleState vehicle_state;
+        Rte::Safety safety;
+    };
+    std::vector<Entry> pdus;
+};
+
+// Session id for a sender starting now: NowNs() in ms, truncated, never 0.
+// Sender and receiver share the clock on loopback, so a restart is newer.
+uint32_t NewSession();
+
+// True if session a started after b (wrapping; restarts less than 24 days apart)
+inline bool SessionNewer(uint32_t a, uint32_t b) { return static_cast<int32_t>(a - b) > 0; }
+
+/**
+ * @brief Packs PDUs into datagrams of at most kMaxDatagramBytes
+ *
+ * Add() appends to the open datagram and starts a new one when the PDU would
+ * not fit. Finish() stamps the headers and returns the datagrams ready to
+ * send; Clear() starts over without releasing the buffers (and keeps the session).
+ */
+class DatagramBuilder {
+public:
+    void Add(uint16_t cycle, const Rte::DriverInput& v);
+    void Add(uint16_t cycle, const Rte::ActuatorCmd& v);
+    void Add(uint16_t cycle, const Rte::VehicleState& v);
+    void Add(uint16_t cycle, const Rte::Safety& v);
+
+    // Starts a new datagram even if the open one has room (one datagram per
+    // cycle, say); sent empty it is a header without PDUs
+    void StartDatagram();
+    void SetSession(uint32_t session) { session_ = session; }
+    // Stamps the session, seq (consecutive from first_seq) and stamp_ns into every header
+    void Finish(uint32_t first_seq, int64_t stamp_ns);
+    void Clear();
+
+    std::size_t DatagramCount() const { return count_; }
+    std::size_t PduCount() const { return pdus_; }
+    const std::vector<uint8_t>& Datagram(std::size_t i) const { return buffers_[i]; }
+
+private:
+    uint8_t* Reserve(PduId id, uint16_t cycle, std::size_t payload_bytes);
+
+    std::vector<std::vector<uint8_t>> buffers_; // reused; the first count_ are in use
+    std::size_t count_ = 0;
+    std::size_t pdus_ = 0;
+    uint32_t session_ = 0;
+};
+
+// Parses one datagram; false (batch untouched) if it is not a well-formed v2 datagram
+bool DecodeDatagram(const uint8_t* data, std::size_t size, PduBatch& out);
+
+// True if counter a is newer than b on the wrapping 16-bit cycle scale
+inline bool CycleNewer(uint16_t a, uint16_t b) { return static_cast<int16_t>(a - b) > 0; }
+
+/**
+ * @brief Non-blocking UDP socket on 127.0.0.1 that moves whole batches
+ *
+ * Send() hands all datagrams of a builder to the kernel with as few
+ * sendmmsg calls as possible; Receive() takes up to kRecvBatch queued
+ * datagrams with one recvmmsg. Without a fixed peer, the owner picks which
+ * sender to answer (LearnPeer), so a stray or malformed datagram cannot
+ * redirect the replies. The peer is atomic, so one thread may send while
+ * another receives.
+ */
+class UdpSocket {
+public:
+    static constexpr std::size_t kSendBatch = 64;
+    static constexpr std::size_t kRecvBatch = 32;
+
+    UdpSocket() = default;
+    ~UdpSocket() { Close(); }
+    UdpSocket(const UdpSocket&) = delete;
+    UdpSocket& operator=(const UdpSocket&) = delete;
+
+    // bind_port 0 = any free port (see LocalPort())
+    bool Open(uint16_t bind_port, std::string& err);
+    void Close();
+    bool IsOpen() const { return fd_ >= 0; }
+    uint16_t LocalPort() const { return local_port_; }
+
+    void SetPeer(uint16_t port); // 127.0.0.1:port, never replaced by LearnPeer()
+    void LearnPeer(uint64_t from); // replies go to `from` (an RxFrom value) unless the peer is fixed
+    bool HasPeer() const { return peer_.load(std::memory_order_acquire) != 0; }
+
+    // Returns the number of datagrams the kernel accepted (0 without a peer)
+    std::size_t Send(const DatagramBuilder& b);
+    // Returns the number of datagrams received into RxData/RxSize (0 if none queued);
+    // truncated datagrams are reported with size 0
+    std::size_t Receive();
+    const uint8_t* RxData(std::size_t i) const { return rx_[i].data(); }
+    std::size_t RxSize(std::size_t i) const { return rx_size_[i]; }
+    uint64_t RxFrom(std::size_t i) const { return rx_from_[i]; } // packed sender address
+    // Blocks until a datagram is queued or timeout_ms elapsed; true if readable
+    bool WaitReadable(int timeout_ms) const;
+
+    uint64_t SendCalls() const { return send_calls_; }
+    uint64_t RecvCalls() const { return recv_calls_; }
+
+private:
+    int fd_ = -1;
+    uint16_t local_port_ = 0;
+    bool fixed_peer_ = false;
+    std::atomic<uint64_t> peer_{0}; // 1 << 48 | IPv4 address << 16 | port (network order), 0 = none
+    std::array<std::array<uint8_t, kMaxDatagramBytes>, kRecvBatch> rx_{};
+    std::array<std::size_t, kRecvBatch> rx_size_{};
+    std::array<uint64_t, kRecvBatch> rx_from_{};
+    uint64_t send_calls_ = 0;
+    uint64_t recv_calls_ = 0;
+};
+
+struct UdpConfig {
+    uint16_t bind_port = 0;    // on 127.0.0.1; 0 = any free port
+    uint16_t peer_port = 0;    // 127.0.0.1:peer_port; 0 = reply to the sender of the newest accepted DriverInput
+    uint32_t batch_cycles = 1; // 10ms cycles packed before the datagrams are sent
+};
+
+struct UdpStats {
+    uint64_t datagrams_tx = 0;
+    uint64_t pdus_tx = 0;
+    uint64_t send_calls = 0;
+    uint64_t send_dropped = 0;  // datagrams not sent: no peer yet or socket buffer full
+    uint64_t datagrams_rx = 0;
+    uint64_t pdus_rx = 0;
+    uint64_t recv_calls = 0;
+    uint64_t malformed = 0;     // datagrams that failed DecodeDatagram
+    uint64_t inputs = 0;        // DriverInput PDUs taken as the newest input
+    uint64_t stale_inputs = 0;  // DriverInput PDUs not newer than the one already held
+    uint64_t restarts = 0;      // inputs taken from a newer sender session
+};
+
+/**
+ * @brief ECU end of the UDP link
+ *
+ * Tick10ms() packs the signals whose RTE sequence numbers moved this cycle
+ * and every batch_cycles cycles sends all pending datagrams at once. Poll()
+ * drains the socket and keeps the newest DriverInput by session, then PDU
+ * cycle counter, so late or duplicated datagrams cannot roll it back while a
+ * restarted sender is followed at once; without a fixed peer, replies go to
+ * the sender of that input. Nothing reaches the RTE until the DriverInput
+ * runnable samples it (App::ComInputSource). Close() sends what is packed.
+ * Tick10ms/Flush and Poll may run on different threads, each on one only.
+ */
+class UdpGateway {
+public:
+    bool Open(const UdpConfig& cfg, std::string& err);
+    void Close();
+    bool IsOpen() const { return sock_.IsOpen(); }
+    uint16_t LocalPort() const { return sock_.LocalPort(); }
+
+    void Tick10ms(const Rte::Context& ctx);
+    void Flush(); // sends what is packed so far
+
+    // Returns the number of datagrams received
+    std::size_t Poll();
+    // Newest DriverInput received; rx_ns is the NowNs() of its arrival
+    bool LatestInput(Rte::DriverInput& in, uint16_t& cycle, int64_t& rx_ns) const;
+
+    UdpStats Stats() const;
+
+private:
+    UdpSocket sock_;
+    UdpConfig cfg_{};
+
+    DatagramBuilder tx_;
+    uint16_t cycle_ = 0;
+    uint32_t tx_seq_ = 0;
+    uint32_t batched_cycles_ = 0;
+    uint64_t seq_driver_input_ = UINT64_MAX;
+    uint64_t seq_actuator_cmd_ = UINT64_MAX;
+    uint64_t seq_vehicle_state_ = UINT64_MAX;
+    uint64_t seq_safety_ = UINT64_MAX;
+
+    PduBatch batch_;
+    bool have_input_ = false;
+    Rte::DriverInput input_{};
+    uint32_t input_session_ = 0;
+    uint16_t input_cycle_ = 0;
+    int64_t input_rx_ns_ = 0;
+
+    UdpStats stats_{};
+};
+
+} // namespace Bsw::Com
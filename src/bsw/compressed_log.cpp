@@ -0,0 +1,619 @@
+#include "bsw/compressed_log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace Bsw::CompressedLog {
+
+namespace {
+
+constexpr double kPow10[10] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+constexpr uint64_t kPow10U[10] = {1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL,
+                                  1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL};
+constexpr uint8_t kMaxDecimals = 9;
+
+uint64_t ZigZag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+int64_t UnZigZag(uint64_t z) { return static_cast<int64_t>(z >> 1) ^ -static_cast<int64_t>(z & 1); }
+
+void PutVarint(std::vector<uint8_t>& out, uint64_t v)
+{
+    while (v >= 0x80) {
+        out.push_back(static_cast<uint8_t>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+bool GetVarint(const uint8_t*& p, const uint8_t* end, uint64_t& v)
+{
+    v = 0;
+    for (unsigned shift = 0; shift < 64 && p < end; shift += 7) {
+        const uint8_t b = *p++;
+        v |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if ((b & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+// Differences of the given order in place (the value before the block is 0).
+// Modular arithmetic, so corrupt input cannot overflow.
+void Differentiate(std::vector<int64_t>& x, int order)
+{
+    for (int k = 0; k < order; ++k) {
+        uint64_t prev = 0;
+        for (auto& v : x) {
+            const auto cur = static_cast<uint64_t>(v);
+            v = static_cast<int64_t>(cur - prev);
+            prev = cur;
+        }
+    }
+}
+
+void Integrate(std::vector<int64_t>& x, int order)
+{
+    for (int k = 0; k < order; ++k) {
+        uint64_t acc = 0;
+        for (auto& v : x) {
+            acc += static_cast<uint64_t>(v);
+            v = static_cast<int64_t>(acc);
+        }
+    }
+}
+
+// Tokens: varint(zigzag(delta) << 1 | has_run) [, varint(run - 2)]
+void EncodeTokens(const std::vector<int64_t>& x, std::vector<uint8_t>& out)
+{
+    const std::size_t n = x.size();
+    for (std::size_t i = 0; i < n;) {
+        std::size_t run = 1;
+        while (i + run < n && x[i + run] == x[i]) ++run;
+        const uint64_t z = ZigZag(x[i]) << 1;
+        if (run == 1) {
+            PutVarint(out, z);
+        } else {
+            PutVarint(out, z | 1);
+            PutVarint(out, run - 2);
+        }
+        i += run;
+    }
+}
+
+bool DecodeTokens(const uint8_t* p, const uint8_t* end, std::size_t rows, std::vector<int64_t>& x)
+{
+    x.clear();
+    while (x.size() < rows) {
+        uint64_t tok = 0;
+        if (!GetVarint(p, end, tok)) return false;
+        uint64_t run = 1;
+        if (tok & 1) {
+            if (!GetVarint(p, end, run)) return false;
+            run += 2;
+        }
+        if (run > rows - x.size()) return false;
+        x.insert(x.end(), static_cast<std::size_t>(run), UnZigZag(tok >> 1));
+    }
+    return p == end;
+}
+
+// Bit-packed stream (patched frame of reference). The first `head` values (the
+// block's starting values, as large as the codes themselves) are zigzag
+// varints. The rest are stored as x - lo in `width` bits, LSB first; values
+// outside [lo, lo + 2^width) are exceptions, listed up front as
+// varint(index gap), varint(zigzag(x)), with zero in their packed slot:
+//   head varints, varint(zigzag(lo)), width byte, varint(exception count),
+//   exceptions, packed bits
+// so a few outliers (a ramp restarting, a step input) do not widen the frame.
+constexpr unsigned kMaxPackedWidth = 56; // one value always fits the 64-bit accumulator
+
+struct Frame {
+    int64_t lo = 0;
+    unsigned width = 0;
+};
+
+std::size_t VarintSize(uint64_t v)
+{
+    std::size_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        ++n;
+    }
+    return n;
+}
+
+unsigned BitWidth(uint64_t range)
+{
+    unsigned width = 0;
+    while (range != 0) {
+        ++width;
+        range >>= 1;
+    }
+    return width;
+}
+
+bool InFrame(int64_t v, const Frame& f)
+{
+    const uint64_t off = static_cast<uint64_t>(v) - static_cast<uint64_t>(f.lo);
+    return f.width >= 64 || (off >> f.width) == 0;
+}
+
+std::size_t PackedSize(const std::vector<int64_t>& x, std::size_t head, const Frame& f)
+{
+    head = std::min(head, x.size());
+    std::size_t size = VarintSize(ZigZag(f.lo)) + 1;
+    for (std::size_t i = 0; i < head; ++i) size += VarintSize(ZigZag(x[i]));
+    std::size_t exceptions = 0;
+    std::size_t last = head;
+    for (std::size_t i = head; i < x.size(); ++i) {
+        if (InFrame(x[i], f)) continue;
+        ++exceptions;
+        size += VarintSize(i - last) + VarintSize(ZigZag(x[i]));
+        last = i;
+    }
+    return size + VarintSize(exceptions) + ((x.size() - head) * f.width + 7) / 8;
+}
+
+// Smallest of a few candidate frames: the full range, and one around the
+// (sampled) median whose width is chosen from a histogram of distances to it (bits per
+// value against an estimated 3 bytes per exception)
+Frame ChooseFrame(const std::vector<int64_t>& x, std::size_t head, std::vector<int64_t>& scratch,
+                  std::size_t& size)
+{
+    size = SIZE_MAX;
+    if (x.size() <= head) {
+        size = PackedSize(x, head, Frame{});
+        return Frame{};
+    }
+    const auto first = x.begin() + static_cast<std::ptrdiff_t>(head);
+    const std::size_t n = x.size() - head;
+    const auto [mn, mx] = std::minmax_element(first, x.end());
+    Frame best{*mn, BitWidth(static_cast<uint64_t>(*mx) - static_cast<uint64_t>(*mn))};
+    if (best.width <= kMaxPackedWidth) {
+        size = VarintSize(ZigZag(best.lo)) + 2 + (n * best.width + 7) / 8; // no exceptions
+        for (std::size_t i = 0; i < head; ++i) size += VarintSize(ZigZag(x[i]));
+    }
+    if (best.width <= 2) return best; // outliers cannot save more than that
+
+    // Median of a strided sample is centre enough and far cheaper than the exact one
+    constexpr std::size_t kSamples = 256;
+    const std::size_t stride = std::max<std::size_t>(n / kSamples, 1);
+    scratch.clear();
+    for (std::size_t i = head; i < x.size(); i += stride) scratch.push_back(x[i]);
+    const auto mid = scratch.begin() + static_cast<std::ptrdiff_t>(scratch.size() / 2);
+    std::nth_element(scratch.begin(), mid, scratch.end());
+    const int64_t median = *mid;
+    // hist[b]: values needing a frame of width b around the median; low[b]: smallest of them
+    std::size_t hist[65] = {};
+    int64_t low[65];
+    std::fill(std::begin(low), std::end(low), median);
+    for (auto it = first; it != x.end(); ++it) {
+        const uint64_t d = static_cast<uint64_t>(*it) - static_cast<uint64_t>(median);
+        const uint64_t dist = static_cast<int64_t>(d) < 0 ? ~d : d; // values below need one bit less
+        const unsigned b = dist == 0 ? 0 : std::min(BitWidth(dist) + 1, 64u);
+        ++hist[b];
+        low[b] = std::min(low[b], *it);
+    }
+    unsigned width = 0;
+    int64_t lo = median;
+    int64_t lo_best = median;
+    std::size_t best_cost = SIZE_MAX;
+    std::size_t outside = n;
+    for (unsigned w = 0; w <= kMaxPackedWidth; ++w) {
+        outside -= hist[w];
+        lo = std::min(lo, low[w]);
+        const std::size_t cost = n * w / 8 + outside * 3;
+        if (cost < best_cost) {
+            best_cost = cost;
+            width = w;
+            lo_best = lo;
+        }
+    }
+    // Anchored on the smallest inlier, one-sided spreads often fit a bit narrower
+    for (const unsigned w : {width, width == 0 ? 0u : width - 1}) {
+        const Frame f{lo_best, w};
+        const std::size_t sz = PackedSize(x, head, f);
+        if (sz < size) {
+            best = f;
+            size = sz;
+        }
+    }
+    return best;
+}
+
+void EncodePacked(const std::vector<int64_t>& x, std::size_t head, const Frame& f, std::vector<uint8_t>& out)
+{
+    head = std::min(head, x.size());
+    for (std::size_t i = 0; i < head; ++i) PutVarint(out, ZigZag(x[i]));
+    PutVarint(out, ZigZag(f.lo));
+    out.push_back(static_cast<uint8_t>(f.width));
+    std::size_t exceptions = 0;
+    for (std::size_t i = head; i < x.size(); ++i) exceptions += InFrame(x[i], f) ? 0 : 1;
+    PutVarint(out, exceptions);
+    std::size_t last = head;
+    for (std::size_t i = head; i < x.size(); ++i) {
+        if (InFrame(x[i], f)) continue;
+        PutVarint(out, i - last);
+        PutVarint(out, ZigZag(x[i]));
+        last = i;
+    }
+    if (f.width == 0) return;
+    uint64_t acc = 0;
+    unsigned bits = 0;
+    for (std::size_t i = head; i < x.size(); ++i) {
+        const uint64_t off = InFrame(x[i], f) ? static_cast<uint64_t>(x[i]) - static_cast<uint64_t>(f.lo) : 0;
+        acc |= off << bits;
+        bits += f.width;
+        while (bits >= 8) {
+            out.push_back(static_cast<uint8_t>(acc));
+            acc >>= 8;
+            bits -= 8;
+        }
+    }
+    if (bits > 0) out.push_back(static_cast<uint8_t>(acc));
+}
+
+bool DecodePacked(const uint8_t* p, const uint8_t* end, std::size_t rows, std::size_t head,
+                  std::vector<int64_t>& x)
+{
+    head = std::min(head, rows);
+    x.resize(rows);
+    uint64_t z = 0;
+    for (std::size_t i = 0; i < head; ++i) {
+        if (!GetVarint(p, end, z)) return false;
+        x[i] = UnZigZag(z);
+    }
+    if (!GetVarint(p, end, z) || p == end) return false;
+    const uint64_t lo = static_cast<uint64_t>(UnZigZag(z));
+    const unsigned width = *p++;
+    uint64_t exceptions = 0;
+    if (width > kMaxPackedWidth || !GetVarint(p, end, exceptions) || exceptions > rows - head) return false;
+    const uint8_t* exc = p;
+    for (uint64_t k = 0; k < exceptions; ++k) {
+        if (!GetVarint(p, end, z) || !GetVarint(p, end, z)) return false;
+    }
+    const std::size_t n = rows - head;
+    if (static_cast<std::size_t>(end - p) != (n * width + 7) / 8) return false;
+    const uint64_t mask = width == 0 ? 0 : (~uint64_t{0} >> (64 - width));
+    uint64_t acc = 0;
+    unsigned bits = 0;
+    for (std::size_t i = head; i < rows; ++i) {
+        while (bits < width) {
+            acc |= static_cast<uint64_t>(*p++) << bits;
+            bits += 8;
+        }
+        x[i] = static_cast<int64_t>(lo + (acc & mask));
+        acc = width == 0 ? acc : acc >> width;
+        bits -= width;
+    }
+    uint64_t idx = head;
+    for (uint64_t k = 0; k < exceptions; ++k) {
+        uint64_t gap = 0;
+        GetVarint(exc, end, gap);
+        GetVarint(exc, end, z);
+        idx += gap;
+        if (idx >= rows || (k > 0 && gap == 0)) return false;
+        x[idx] = UnZigZag(z);
+    }
+    return true;
+}
+
+void PutStream(std::vector<uint8_t>& out, Codec codec, const uint8_t* data, std::size_t size)
+{
+    out.push_back(static_cast<uint8_t>(codec));
+    PutVarint(out, size);
+    out.insert(out.end(), data, data + size);
+}
+
+bool ValidHeader(const FileHeader& h)
+{
+    return std::memcmp(h.magic, kFileMagic, sizeof(h.magic)) == 0 && h.version == kVersion;
+}
+
+} // namespace
+
+bool Quantize(float v, uint8_t decimals, int64_t& code)
+{
+    if (!std::isfinite(v) || decimals > kMaxDecimals) return false;
+    // float * 10^d (d <= 9) needs at most 24 + 21 mantissa bits: the product is
+    // exact, so round-half-even here matches printf's rounding of the float
+    const double scaled = std::fabs(static_cast<double>(v)) * kPow10[decimals];
+    if (scaled >= 0x1p52) return false;
+    // Round half to even without a libm call: adding 2^52 leaves no fraction bits
+    const auto q = static_cast<int64_t>((scaled + 0x1p52) - 0x1p52);
+    // Sign kept even when the value rounds to zero (printf writes "-0.000")
+    code = std::signbit(v) ? -q - 1 : q;
+    return true;
+}
+
+int FormatCode(int64_t code, uint8_t decimals, char* buf)
+{
+    const bool neg = code < 0;
+    const uint64_t q = neg ? static_cast<uint64_t>(-(code + 1)) : static_cast<uint64_t>(code);
+    const char* sign = neg ? "-" : "";
+    if (decimals == 0) {
+        return std::snprintf(buf, 32, "%s%llu", sign, static_cast<unsigned long long>(q));
+    }
+    const uint64_t p = kPow10U[std::min(decimals, kMaxDecimals)];
+    return std::snprintf(buf, 32, "%s%llu.%0*llu", sign, static_cast<unsigned long long>(q / p),
+                         static_cast<int>(decimals), static_cast<unsigned long long>(q % p));
+}
+
+void Writer::Open(std::FILE* fp, const std::vector<ColumnDesc>& columns, uint32_t block_rows)
+{
+    Close();
+    fp_ = fp;
+    columns_ = columns;
+    block_rows_ = std::max<uint32_t>(block_rows, 1);
+    rows_ = 0;
+    bytes_ = 0;
+    buffers_.assign(columns_.size(), {});
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        buffers_[c].resize(block_rows_ * ColumnarLog::TypeSize(columns_[c].type));
+    }
+
+    FileHeader h{};
+    std::memcpy(h.magic, kFileMagic, sizeof(h.magic));
+    h.version = kVersion;
+    h.column_count = static_cast<uint32_t>(columns_.size());
+    h.block_rows = block_rows_;
+    std::fwrite(&h, sizeof(h), 1, fp_);
+    for (const auto& c : columns_) {
+        ColumnSchema s{};
+        std::strncpy(s.name, c.name, sizeof(s.name) - 1);
+        s.type = c.type;
+        s.decimals = c.type == ColumnType::F32 ? std::min(c.decimals, kMaxDecimals) : 0;
+        std::fwrite(&s, sizeof(s), 1, fp_);
+    }
+    bytes_ += sizeof(h) + columns_.size() * sizeof(ColumnSchema);
+}
+
+void Writer::Append(const void* row)
+{
+    const auto* src = static_cast<const uint8_t*>(row);
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const std::size_t sz = ColumnarLog::TypeSize(columns_[c].type);
+        std::memcpy(buffers_[c].data() + rows_ * sz, src + columns_[c].offset, sz);
+    }
+    if (++rows_ == block_rows_) {
+        WriteBlock();
+    }
+}
+
+void Writer::WriteBlock()
+{
+    out_.clear();
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const auto& col = columns_[c];
+        const uint8_t* buf = buffers_[c].data();
+        codes_.resize(rows_);
+
+        bool quantized = true;
+        if (col.type == ColumnType::U8) {
+            for (uint32_t i = 0; i < rows_; ++i) codes_[i] = buf[i];
+        } else {
+            const uint8_t decimals = std::min(col.decimals, kMaxDecimals);
+            for (uint32_t i = 0; i < rows_ && quantized; ++i) {
+                float v;
+                std::memcpy(&v, buf + i * sizeof(float), sizeof(float));
+                quantized = Quantize(v, decimals, codes_[i]);
+            }
+        }
+        if (!quantized) {
+            PutStream(out_, Codec::RawF32, buf, rows_ * sizeof(float));
+            continue;
+        }
+
+        // Both delta orders, each as run-length tokens or bit-packed; keep the shortest
+        Codec best = Codec::Delta1;
+        std::size_t best_size = SIZE_MAX;
+        for (int order = 1; order <= 2; ++order) {
+            Differentiate(codes_, 1);
+            tokens_[order - 1].clear();
+            EncodeTokens(codes_, tokens_[order - 1]);
+            if (tokens_[order - 1].size() < best_size) {
+                best = order == 1 ? Codec::Delta1 : Codec::Delta2;
+                best_size = tokens_[order - 1].size();
+            }
+            if (best_size <= rows_ / 8) continue; // already under a bit per row
+            std::size_t packed_size = 0;
+            const Frame frame = ChooseFrame(codes_, order, scratch_, packed_size);
+            if (packed_size < best_size) {
+                best = order == 1 ? Codec::Packed1 : Codec::Packed2;
+                best_size = packed_size;
+                packed_.clear();
+                EncodePacked(codes_, order, frame, packed_);
+            }
+        }
+        if (col.type == ColumnType::F32 && best_size >= rows_ * sizeof(float)) {
+            PutStream(out_, Codec::RawF32, buf, rows_ * sizeof(float)); // incompressible noise
+            continue;
+        }
+        const std::vector<uint8_t>& stream = best == Codec::Delta1   ? tokens_[0]
+                                             : best == Codec::Delta2 ? tokens_[1]
+                                                                     : packed_;
+        PutStream(out_, best, stream.data(), stream.size());
+    }
+
+    BlockHeader h{};
+    std::memcpy(h.magic, kBlockMagic, sizeof(h.magic));
+    h.rows = rows_;
+    h.payload_bytes = out_.size();
+    std::fwrite(&h, sizeof(h), 1, fp_);
+    std::fwrite(out_.data(), 1, out_.size(), fp_);
+    bytes_ += sizeof(h) + out_.size();
+    rows_ = 0;
+}
+
+void Writer::Flush()
+{
+    if (!fp_) return;
+    if (rows_ > 0) WriteBlock();
+    std::fflush(fp_);
+}
+
+void Writer::Close()
+{
+    if (!fp_) return;
+    Flush();
+    std::fclose(fp_);
+    fp_ = nullptr;
+}
+
+bool StreamReader::Open(const std::string& path, std::string& err)
+{
+    Close();
+    fp_ = std::fopen(path.c_str(), "rb");
+    if (!fp_) {
+        err = "cannot open " + path;
+        return false;
+    }
+    FileHeader h;
+    if (std::fread(&h, sizeof(h), 1, fp_) != 1 || !ValidHeader(h)) {
+        Close();
+        err = path + ": bad magic or unsupported version";
+        return false;
+    }
+    for (uint32_t c = 0; c < h.column_count; ++c) {
+        ColumnSchema s;
+        if (std::fread(&s, sizeof(s), 1, fp_) != 1 ||
+            (s.type != ColumnType::F32 && s.type != ColumnType::U8) || s.decimals > kMaxDecimals) {
+            Close();
+            err = path + ": truncated or invalid schema";
+            return false;
+        }
+        s.name[sizeof(s.name) - 1] = '\0';
+        columns_.push_back(ColumnInfo{s.name, s.type, s.decimals});
+    }
+    blocks_.assign(columns_.size(), Decoded{});
+    block_rows_ = h.block_rows;
+    return true;
+}
+
+void StreamReader::Close()
+{
+    if (fp_) std::fclose(fp_);
+    fp_ = nullptr;
+    columns_.clear();
+    blocks_.clear();
+    payload_.clear();
+    rows_ = 0;
+    err_.clear();
+}
+
+int StreamReader::FindColumn(const std::string& name) const
+{
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        if (columns_[c].name == name) return static_cast<int>(c);
+    }
+    return -1;
+}
+
+bool StreamReader::NextBlock()
+{
+    rows_ = 0;
+    if (!fp_) return false;
+
+    BlockHeader h;
+    if (std::fread(&h, sizeof(h), 1, fp_) != 1 || std::memcmp(h.magic, kBlockMagic, sizeof(h.magic)) != 0) {
+        return false;
+    }
+    // Raw floats are the largest stream a writer produces; anything beyond is corruption
+    if (h.rows > block_rows_ || h.payload_bytes > columns_.size() * (16 + uint64_t{h.rows} * sizeof(float))) {
+        err_ = "corrupt block";
+        return false;
+    }
+    payload_.resize(h.payload_bytes);
+    if (std::fread(payload_.data(), 1, payload_.size(), fp_) != payload_.size()) return false;
+
+    const uint8_t* p = payload_.data();
+    const uint8_t* const end = p + payload_.size();
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        auto& d = blocks_[c];
+        d.values_ready = false;
+        uint64_t size = 0;
+        if (p == end) {
+            err_ = "corrupt block";
+            return false;
+        }
+        const auto codec = static_cast<Codec>(*p++);
+        if (!GetVarint(p, end, size) || size > static_cast<uint64_t>(end - p)) {
+            err_ = "corrupt column '" + columns_[c].name + "'";
+            return false;
+        }
+
+        const uint8_t* stream_end = p + size;
+        bool ok = false;
+        if (codec == Codec::RawF32) {
+            ok = columns_[c].type == ColumnType::F32 && size == h.rows * sizeof(float);
+            d.raw = true;
+            d.values_ready = true;
+            d.codes.clear();
+            d.values.resize(h.rows);
+            if (ok) std::memcpy(d.values.data(), p, size);
+        } else if (codec == Codec::Delta1 || codec == Codec::Delta2) {
+            d.raw = false;
+            ok = DecodeTokens(p, stream_end, h.rows, d.codes);
+            if (ok) Integrate(d.codes, codec == Codec::Delta1 ? 1 : 2);
+        } else if (codec == Codec::Packed1 || codec == Codec::Packed2) {
+            d.raw = false;
+            const int order = codec == Codec::Packed1 ? 1 : 2;
+            ok = DecodePacked(p, stream_end, h.rows, order, d.codes);
+            if (ok) Integrate(d.codes, order);
+        }
+        if (!ok) {
+            err_ = "corrupt column '" + columns_[c].name + "'";
+            return false;
+        }
+        p = stream_end;
+    }
+    if (p != end) {
+        err_ = "corrupt block";
+        return false;
+    }
+    rows_ = h.rows;
+    return true;
+}
+
+ColumnarLog::Span<int64_t> StreamReader::Codes(std::size_t col) const
+{
+    const auto& d = blocks_[col];
+    if (d.raw) return {};
+    return ColumnarLog::Span<int64_t>{d.codes.data(), rows_};
+}
+
+ColumnarLog::Span<float> StreamReader::RawValues(std::size_t col) const
+{
+    const auto& d = blocks_[col];
+    if (!d.raw) return {};
+    return ColumnarLog::Span<float>{d.values.data(), rows_};
+}
+
+ColumnarLog::Span<float> StreamReader::Values(std::size_t col)
+{
+    auto& d = blocks_[col];
+    if (!d.values_ready) {
+        // Parse the printed text so the floats equal what a CSV reader gets
+        d.values.resize(rows_);
+        char buf[32];
+        for (std::size_t i = 0; i < rows_; ++i) {
+            FormatCode(d.codes[i], columns_[col].decimals, buf);
+            d.values[i] = std::strtof(buf, nullptr);
+        }
+        d.values_ready = true;
+    }
+    return ColumnarLog::Span<float>{d.values.data(), rows_};
+}
+
+bool IsCompressedLog(const std::string& path)
+{
+    std::FILE* fp = std::fopen(path.c_str(), "rb");
+    if (!fp) return false;
+    FileHeader h{};
+    const bool ok = std::fread(&h, sizeof(h), 1, fp) == 1 && ValidHeader(h);
+    std::fclose(fp);
+    return ok;
+}
+
+} // namespace Bsw::CompressedLog
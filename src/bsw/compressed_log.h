@@ -0,0 +1,183 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "bsw/columnar_log.h"
+
+// Compressed block log file ("SDVZLOG1") for long soak runs, little-endian:
+//
+//   FileHeader
+//   ColumnSchema[column_count]
+//   { BlockHeader, column 0 stream, column 1 stream, ... }*
+//
+// Every value is quantized to the precision the CSV prints (`decimals`), so a
+// compressed log converts back to exactly the CSV the run would have written.
+// Per block and column the quantized codes are delta coded (first or second
+// order) and written either as zigzag varints, where repeats of the same delta
+// collapse into one token with a run length, or bit-packed at the width of the
+// typical delta range with outliers listed apart (noisy but bounded signals),
+// whichever is smallest. Columns holding a value that cannot be quantized
+// (NaN, inf, huge), or that would not shrink, fall back to raw floats for that
+// block. Deltas restart at every block, so each block decodes on its own and a
+// file cut short by a crash is readable up to its last complete block.
+namespace Bsw::CompressedLog {
+
+using ColumnarLog::ColumnType;
+
+// Maps one member of a row struct to a column
+struct ColumnDesc {
+    const char* name;
+    ColumnType type;
+    std::size_t offset; // offsetof(Row, member)
+    uint8_t decimals;   // F32: digits after the point kept (0..9); U8: ignored
+};
+
+constexpr char kFileMagic[8] = {'S', 'D', 'V', 'Z', 'L', 'O', 'G', '1'};
+constexpr char kBlockMagic[4] = {'Z', 'B', 'L', 'K'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kDefaultBlockRows = 4096;
+
+// Column stream encodings (first byte of every column stream)
+enum class Codec : uint8_t {
+    Delta1 = 0,  // first differences as run-length zigzag-varint tokens
+    Delta2 = 1,  // second differences (smooth signals), same tokens
+    RawF32 = 2,  // 4 bytes per row, native float bits
+    Packed1 = 3, // first differences bit-packed in a frame of reference, outliers patched
+    Packed2 = 4  // second differences, bit-packed
+};
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t column_count;
+    uint32_t block_rows; // capacity; the last block may hold fewer
+    uint32_t reserved;
+};
+
+struct ColumnSchema {
+    char name[30]; // NUL terminated
+    ColumnType type;
+    uint8_t decimals;
+};
+
+struct BlockHeader {
+    char magic[4];
+    uint32_t rows;
+    uint64_t payload_bytes; // bytes of column streams following this header
+};
+
+static_assert(sizeof(FileHeader) == 24 && sizeof(ColumnSchema) == 32 && sizeof(BlockHeader) == 16,
+              "on-disk layout");
+
+/**
+ * @brief Buffers rows and writes one compressed block every block_rows rows
+ *
+ * Append() only copies the row; quantization and coding run when a block is
+ * full (with Bsw::Logging::Mode::Async that is the writer thread).
+ * Not thread safe; Bsw::Logging calls it from exactly one thread.
+ */
+class Writer {
+public:
+    Writer() = default;
+    ~Writer() { Close(); }
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    // Takes ownership of fp (closed by Close()).
+    void Open(std::FILE* fp, const std::vector<ColumnDesc>& columns,
+              uint32_t block_rows = kDefaultBlockRows);
+    void Append(const void* row);
+    void Flush(); // writes the pending partial block, if any
+    void Close();
+
+    bool IsOpen() const { return fp_ != nullptr; }
+    uint64_t BytesWritten() const { return bytes_; }
+
+private:
+    void WriteBlock();
+
+    std::FILE* fp_ = nullptr;
+    std::vector<ColumnDesc> columns_;
+    std::vector<std::vector<uint8_t>> buffers_; // raw values, one per column
+    std::vector<int64_t> codes_;                // scratch
+    std::vector<int64_t> scratch_;              // percentile selection
+    std::vector<uint8_t> tokens_[2];            // candidate streams, delta order 1/2
+    std::vector<uint8_t> packed_;
+    std::vector<uint8_t> out_;                  // encoded block
+    uint32_t block_rows_ = kDefaultBlockRows;
+    uint32_t rows_ = 0;
+    uint64_t bytes_ = 0;
+};
+
+struct ColumnInfo {
+    std::string name;
+    ColumnType type;
+    uint8_t decimals;
+};
+
+/**
+ * @brief Sequential block-at-a-time reader (constant memory, any file length)
+ *
+ * Quantized columns are exposed as integer codes (Codes()) from which the
+ * CSV text is formatted exactly (FormatValue()); Values() turns a column into
+ * floats, the same floats a CSV reader would parse.
+ * Spans are valid until the next NextBlock().
+ */
+class StreamReader {
+public:
+    StreamReader() = default;
+    ~StreamReader() { Close(); }
+    StreamReader(const StreamReader&) = delete;
+    StreamReader& operator=(const StreamReader&) = delete;
+
+    bool Open(const std::string& path, std::string& err);
+    void Close();
+
+    std::size_t ColumnCount() const { return columns_.size(); }
+    const ColumnInfo& Column(std::size_t col) const { return columns_[col]; }
+    int FindColumn(const std::string& name) const;
+
+    // Loads and decodes the next complete block; false at end of file, a
+    // truncated tail or a corrupt block (Error() tells which)
+    bool NextBlock();
+    std::size_t Rows() const { return rows_; }
+    const std::string& Error() const { return err_; }
+
+    // F32 columns of the current block stored raw (no codes, see RawValues())
+    bool IsRaw(std::size_t col) const { return blocks_[col].raw; }
+    ColumnarLog::Span<int64_t> Codes(std::size_t col) const;
+    ColumnarLog::Span<float> RawValues(std::size_t col) const;
+    // Decoded floats of any F32 column (computed on first use per block)
+    ColumnarLog::Span<float> Values(std::size_t col);
+
+private:
+    struct Decoded {
+        bool raw = false;
+        bool values_ready = false;
+        std::vector<int64_t> codes;
+        std::vector<float> values; // raw column or decoded on demand
+    };
+
+    std::FILE* fp_ = nullptr;
+    std::vector<ColumnInfo> columns_;
+    std::vector<Decoded> blocks_; // one per column, reused
+    std::vector<uint8_t> payload_;
+    uint32_t block_rows_ = 0;
+    std::size_t rows_ = 0;
+    std::string err_;
+};
+
+// Text of one quantized value with `decimals` digits, exactly as printf("%.*f")
+// prints the original float. Returns the length written (buf >= 32 bytes).
+int FormatCode(int64_t code, uint8_t decimals, char* buf);
+
+// Quantized code of v, or false if v cannot be represented (NaN, inf, too large)
+bool Quantize(float v, uint8_t decimals, int64_t& code);
+
+// True if the file starts with the compressed log magic
+bool IsCompressedLog(const std::string& path);
+
+} // namespace Bsw::CompressedLog
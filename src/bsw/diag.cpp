@@ -1,16 +1,77 @@
 #include "bsw/diag.h"
 
-namespace {
-    uint64_t g_hb = 0;
-}
+#include <algorithm>
 
 namespace Bsw::Diag {
 
-void Init() { g_hb = 0; }
+void Init(Rte::Context& ctx) { ctx.diag = Rte::DiagPim{}; }
+void Init() { Init(Rte::DefaultContext()); }
 void Tick10ms() { /* reserved */ }
 void Tick100ms() { /* reserved */ }
 
-uint64_t GetHeartbeat() { return g_hb; }
-void BumpHeartbeat() { ++g_hb; }
+uint64_t GetHeartbeat(const Rte::Context& ctx) { return ctx.diag.heartbeat; }
+void BumpHeartbeat(Rte::Context& ctx) { ++ctx.diag.heartbeat; }
+
+uint64_t GetHeartbeat() { return GetHeartbeat(Rte::DefaultContext()); }
+void BumpHeartbeat() { BumpHeartbeat(Rte::DefaultContext()); }
+
+SupervisionResult Supervise(Rte::Context& ctx, int64_t cycle_ms)
+{
+    auto& d = ctx.diag;
+    const int64_t now = d.supervision_ms < 0 ? 0 : d.supervision_ms + cycle_ms;
+    d.supervision_ms = now;
+
+    SupervisionResult r;
+    const auto& cfg = Rte::Rte_Prm_Supervision(ctx);
+    for (std::size_t i = 0; i < Rte::kSupervisedEntities; ++i) {
+        const auto& c = cfg[i];
+        auto& m = d.monitor[i];
+        const uint32_t count = d.alive[i].count.load(std::memory_order_relaxed);
+        if (!c.enabled || c.period_ms == 0) continue;
+
+        if (!m.started) {
+            if (count == 0) continue;
+            m.started = true;
+            m.seen = count;
+            m.deadline_ms = now + c.period_ms;
+            continue;
+        }
+
+        const uint32_t delta = count - m.seen; // wraps correctly
+        m.seen = count;
+        m.deadline_ms = std::min(m.deadline_ms + static_cast<int64_t>(delta) * c.period_ms, now + c.period_ms);
+
+        uint32_t missed = 0;
+        while (now >= m.deadline_ms + c.tolerance_ms) {
+            ++missed;
+            m.deadline_ms += c.period_ms;
+        }
+        m.missed_total += missed;
+        r.missed += missed;
+
+        if (m.status != Rte::SupervisionStatus::Expired) {
+            m.failed_cycles = missed > 0 ? m.failed_cycles + 1 : 0;
+            if (m.failed_cycles > c.failed_cycles_tolerance) {
+                m.status = Rte::SupervisionStatus::Expired;
+            } else {
+                m.status = missed > 0 ? Rte::SupervisionStatus::Failed : Rte::SupervisionStatus::Ok;
+            }
+        }
+        if (m.status == Rte::SupervisionStatus::Failed) r.failed_mask |= 1u << i;
+        if (m.status == Rte::SupervisionStatus::Expired) r.expired_mask |= 1u << i;
+        r.worst = std::max(r.worst, m.status);
+    }
+    return r;
+}
+
+Rte::SupervisionStatus GetStatus(const Rte::Context& ctx, Rte::SupervisedEntity e)
+{
+    return ctx.diag.monitor[static_cast<std::size_t>(e)].status;
+}
+
+uint64_t GetMissedDeadlines(const Rte::Context& ctx, Rte::SupervisedEntity e)
+{
+    return ctx.diag.monitor[static_cast<std::size_t>(e)].missed_total;
+}
 
 } // namespace Bsw::Diag
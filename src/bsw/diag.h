@@ -1,14 +1,51 @@
 #pragma once
 #include <cstdint>
 
+#include "rte/rte.h"
+
 namespace Bsw::Diag {
 
+void Init(Rte::Context& ctx);
 void Init();
 void Tick10ms();
 void Tick100ms();
 
-// v1 skeleton: you can expand to per-component heartbeat tracking later.
+// System heartbeat, bumped once per 100ms by SafetySupervisorSWC.
+// The counter lives in the RTE instance (Context::diag).
+uint64_t GetHeartbeat(const Rte::Context& ctx);
+void BumpHeartbeat(Rte::Context& ctx);
+
+// Default RTE instance
 uint64_t GetHeartbeat();
 void BumpHeartbeat();
 
+// Alive indication from a supervised runnable: one relaxed atomic increment
+// on the entity's own slot, safe from any thread.
+inline void ReportAlive(Rte::Context& ctx, Rte::SupervisedEntity e)
+{
+    ctx.diag.alive[static_cast<std::size_t>(e)].count.fetch_add(1, std::memory_order_relaxed);
+}
+
+struct SupervisionResult {
+    Rte::SupervisionStatus worst = Rte::SupervisionStatus::Ok;
+    uint32_t failed_mask = 0;  // bit per SupervisedEntity, Failed this cycle
+    uint32_t expired_mask = 0; // bit per SupervisedEntity, Expired (latched)
+    uint32_t missed = 0;       // deadlines missed in this cycle, all entities
+};
+
+/**
+ * @brief Deadline supervision of all entities for one cycle of cycle_ms
+ *
+ * Every alive indication since the last cycle moves the entity's deadline
+ * forward by its period (capped at now + period, so bursts earn no credit).
+ * Each period whose deadline passed by more than tolerance_ms counts as one
+ * missed deadline. A cycle with misses is Failed; more than
+ * failed_cycles_tolerance consecutive Failed cycles latch Expired.
+ * An entity is only supervised after its first alive indication.
+ */
+SupervisionResult Supervise(Rte::Context& ctx, int64_t cycle_ms);
+
+Rte::SupervisionStatus GetStatus(const Rte::Context& ctx, Rte::SupervisedEntity e);
+uint64_t GetMissedDeadlines(const Rte::Context& ctx, Rte::SupervisedEntity e);
+
 } // namespace Bsw::Diag
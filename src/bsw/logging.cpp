@@ -1,53 +1,621 @@
 #include "bsw/logging.h"
 #include "rte/rte.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <thread>
 
 namespace {
+    using Bsw::Logging::Record;
+
+    // Async ring: ~40s of 10ms samples. Power of two so indices wrap with a mask.
+    constexpr std::size_t kRingSize = 4096;
+    constexpr std::size_t kRingMask = kRingSize - 1;
+    constexpr std::size_t kFileBufSize = 1 << 16;
+
     std::FILE* g_fp = nullptr;
+    Bsw::Logging::Mode g_mode = Bsw::Logging::Mode::Sync;
+    Bsw::Logging::Format g_format = Bsw::Logging::Format::Csv;
+    Bsw::ColumnarLog::Writer g_columnar; // owns g_fp in Columnar format
+    Bsw::CompressedLog::Writer g_compressed; // owns g_fp in Compressed format
+
+    // Single-producer (10ms task) / single-consumer (writer thread) ring.
+    std::array<Record, kRingSize> g_ring{};
+    alignas(64) std::atomic<uint64_t> g_head{0}; // next slot to write (producer)
+    alignas(64) std::atomic<uint64_t> g_tail{0}; // next slot to read (consumer)
+    alignas(64) std::atomic<uint64_t> g_dropped{0};
+    std::atomic<uint64_t> g_written{0};
+    std::atomic<bool> g_stop{false};
+    std::atomic<bool> g_hold{false};
+    std::thread g_writer;
+
+    void write_record(const Record& r)
+    {
+        if (g_format == Bsw::Logging::Format::Columnar) {
+            g_columnar.Append(&r);
+        } else if (g_format == Bsw::Logging::Format::Compressed) {
+            g_compressed.Append(&r);
+        } else {
+            Bsw::Logging::WriteCsvRecord(g_fp, r);
+        }
+    }
+
+    Record capture(const Rte::Context& ctx)
+    {
+        const auto in = Rte::Rte_Read_DriverInput(ctx);
+        const auto cmd = Rte::Rte_Read_ActuatorCmd(ctx);
+        const auto st = Rte::Rte_Read_VehicleState(ctx);
+        const auto sf = Rte::Rte_Read_Safety(ctx);
+
+        return Record{
+            st.t, in.throttle, in.brake, in.steer,
+            cmd.drive_accel_cmd, cmd.brake_decel_cmd, cmd.steer_angle_cmd,
+            st.x, st.y, st.yaw, st.v, st.yaw_rate, st.wheel_omega,
+            static_cast<uint8_t>(sf.estop ? 1 : 0), static_cast<uint8_t>(sf.system_state)
+        };
+    }
+
+    // Formats everything between tail and head. Returns number of records drained.
+    uint64_t drain()
+    {
+        const uint64_t head = g_head.load(std::memory_order_acquire);
+        uint64_t tail = g_tail.load(std::memory_order_relaxed);
+        const uint64_t n = head - tail;
+        for (; tail != head; ++tail) {
+            write_record(g_ring[tail & kRingMask]);
+            // Release each slot right away so the producer sees space early.
+            g_tail.store(tail + 1, std::memory_order_release);
+        }
+        if (n > 0) {
+            if (g_format == Bsw::Logging::Format::Csv) std::fflush(g_fp);
+            g_written.fetch_add(n, std::memory_order_relaxed);
+        }
+        return n;
+    }
+
+    // Mode::Sync with Format::Compressed: the 10ms task only copies rows into a
+    // block; a full block goes to the writer thread, which encodes it. Double
+    // buffered, and lossless: the 10ms task waits if the writer is still on the
+    // previous block (~41 s of samples earlier, so only in unpaced runs).
+    constexpr std::size_t kBlockRows = Bsw::CompressedLog::kDefaultBlockRows;
+    std::array<std::vector<Record>, 2> g_blocks; // allocated at Init
+    std::size_t g_block_cur = 0;  // block the 10ms task fills
+    std::size_t g_block_fill = 0;
+    std::size_t g_handoff_block = 0;
+    alignas(64) std::atomic<uint64_t> g_handoff_rows{0}; // rows of g_handoff_block for the writer, 0 = none
+
+    bool sync_blocks() { return g_mode == Bsw::Logging::Mode::Sync && g_format == Bsw::Logging::Format::Compressed; }
+
+    void hand_off_block()
+    {
+        while (g_handoff_rows.load(std::memory_order_acquire) != 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        g_handoff_block = g_block_cur;
+        g_handoff_rows.store(g_block_fill, std::memory_order_release);
+        g_block_cur ^= 1;
+        g_block_fill = 0;
+    }
+
+    // Writer thread: appends (and thereby encodes) the handed-off block
+    uint64_t write_block()
+    {
+        const uint64_t n = g_handoff_rows.load(std::memory_order_acquire);
+        if (n == 0) return 0;
+        for (uint64_t i = 0; i < n; ++i) g_compressed.Append(&g_blocks[g_handoff_block][i]);
+        g_written.fetch_add(n, std::memory_order_relaxed);
+        g_handoff_rows.store(0, std::memory_order_release);
+        return n;
+    }
+
+    // Flight recorder state (Mode::FlightRecorder), touched by the 10ms task only
+    struct FlightRecorder {
+        Bsw::Logging::FlightRecorderConfig cfg;
+        std::string path;
+        std::vector<Record> ring; // pre + post samples, allocated at Init
+        uint64_t pre = 0;
+        uint64_t post = 0;
+        uint64_t count = 0;       // samples recorded so far
+        uint64_t post_left = 0;   // samples still missing from the open window
+        bool window_open = false;
+        float trigger_t = 0.0f;
+        Record prev{};
+        bool prev_pred = false;
+        unsigned windows = 0;     // windows closed so far; numbers the dump files
+    };
+    FlightRecorder g_fr;
+    std::atomic<bool> g_fr_manual{false};
+
+    // Closed windows on their way to the writer thread: the 10ms task copies a
+    // window into a free slot, the writer thread encodes and writes it (SPSC,
+    // like the record ring). Slots are allocated at Init.
+    constexpr std::size_t kDumpSlots = 4;
+    struct Dump {
+        std::vector<Record> rows; // first n in use
+        uint64_t n = 0;
+        unsigned index = 0;
+        float trigger_t = 0.0f;
+    };
+    std::array<Dump, kDumpSlots> g_dump_slots;
+    alignas(64) std::atomic<uint64_t> g_dump_head{0}; // next slot to fill (10ms task)
+    alignas(64) std::atomic<uint64_t> g_dump_tail{0}; // next slot to write (writer thread)
+    std::atomic<uint64_t> g_dumps{0};
+    std::atomic<uint64_t> g_dump_failures{0};
+
+    // Writer thread: one window to its own file. False if the file cannot be opened.
+    bool fr_write(const Dump& d)
+    {
+        const std::string out = Bsw::Logging::FlightRecorderDumpPath(g_fr.path, d.index);
+        std::FILE* fp = std::fopen(out.c_str(), "w");
+        if (!fp) {
+            std::fprintf(stderr, "Logging: cannot write flight recorder dump %s: %s\n", out.c_str(),
+                         std::strerror(errno));
+            return false;
+        }
+        std::setvbuf(fp, nullptr, _IOFBF, kFileBufSize);
+        Bsw::ColumnarLog::Writer columnar;
+        Bsw::CompressedLog::Writer compressed;
+        if (g_format == Bsw::Logging::Format::Columnar) {
+            columnar.Open(fp, Bsw::Logging::RecordColumns());
+        } else if (g_format == Bsw::Logging::Format::Compressed) {
+            compressed.Open(fp, Bsw::Logging::CompressedRecordColumns());
+        } else {
+            Bsw::Logging::WriteCsvHeader(fp);
+        }
+        for (uint64_t i = 0; i < d.n; ++i) {
+            const Record& r = d.rows[i];
+            if (g_format == Bsw::Logging::Format::Columnar) {
+                columnar.Append(&r);
+            } else if (g_format == Bsw::Logging::Format::Compressed) {
+                compressed.Append(&r);
+            } else {
+                Bsw::Logging::WriteCsvRecord(fp, r);
+            }
+        }
+        if (g_format == Bsw::Logging::Format::Columnar) {
+            columnar.Close();
+        } else if (g_format == Bsw::Logging::Format::Compressed) {
+            compressed.Close();
+        } else {
+            std::fclose(fp);
+        }
+        std::fprintf(stderr, "Logging: flight recorder wrote %llu samples around t=%.2f s to %s\n",
+                     static_cast<unsigned long long>(d.n), static_cast<double>(d.trigger_t), out.c_str());
+        return true;
+    }
+
+    // Writes every queued window. Returns the number taken off the queue.
+    uint64_t fr_write_pending()
+    {
+        const uint64_t head = g_dump_head.load(std::memory_order_acquire);
+        uint64_t tail = g_dump_tail.load(std::memory_order_relaxed);
+        const uint64_t n = head - tail;
+        for (; tail != head; ++tail) {
+            const Dump& d = g_dump_slots[tail % kDumpSlots];
+            if (fr_write(d)) {
+                g_dumps.fetch_add(1, std::memory_order_relaxed);
+                g_written.fetch_add(d.n, std::memory_order_relaxed);
+            } else {
+                g_dump_failures.fetch_add(1, std::memory_order_relaxed);
+            }
+            g_dump_tail.store(tail + 1, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // 10ms task: freezes the window into a dump slot and closes it. No file I/O;
+    // if the writer is still busy with kDumpSlots earlier windows this one is lost.
+    void fr_close_window()
+    {
+        g_fr.window_open = false;
+        const unsigned index = g_fr.windows++;
+        const uint64_t head = g_dump_head.load(std::memory_order_relaxed);
+        if (head - g_dump_tail.load(std::memory_order_acquire) >= kDumpSlots) {
+            g_dump_failures.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        Dump& d = g_dump_slots[head % kDumpSlots];
+        d.n = std::min<uint64_t>(g_fr.count, g_fr.ring.size());
+        for (uint64_t i = 0; i < d.n; ++i) d.rows[i] = g_fr.ring[(g_fr.count - d.n + i) % g_fr.ring.size()];
+        d.index = index;
+        d.trigger_t = g_fr.trigger_t;
+        g_dump_head.store(head + 1, std::memory_order_release);
+    }
+
+    void fr_sample(const Record& r)
+    {
+        g_fr.ring[g_fr.count % g_fr.ring.size()] = r;
+        ++g_fr.count;
 
-    void write_header()
+        const bool pred = g_fr.cfg.predicate && g_fr.cfg.predicate(r);
+        const bool fault = r.system_state != g_fr.prev.system_state &&
+                           (r.system_state == static_cast<uint8_t>(Rte::SystemState::EStop) ||
+                            r.system_state == static_cast<uint8_t>(Rte::SystemState::Degraded));
+        const bool trigger = g_fr_manual.exchange(false, std::memory_order_relaxed) ||
+                             (g_fr.cfg.on_estop && r.estop && !g_fr.prev.estop) ||
+                             (g_fr.cfg.on_fault_state && fault) ||
+                             (pred && !g_fr.prev_pred);
+        g_fr.prev = r;
+        g_fr.prev_pred = pred;
+
+        if (g_fr.window_open) {
+            if (--g_fr.post_left == 0) fr_close_window();
+        } else if (trigger) {
+            g_fr.window_open = true;
+            g_fr.trigger_t = r.t;
+            g_fr.post_left = g_fr.post;
+            if (g_fr.post_left == 0) fr_close_window();
+        }
+    }
+
+    // Record ring (Mode::Async), dump slots (Mode::FlightRecorder) or compressed blocks (Mode::Sync)
+    uint64_t write_pending()
     {
-        std::fprintf(g_fp,
-            "t,throttle,brake,steer,"
-            "drive_accel_cmd,brake_decel_cmd,steer_angle_cmd,"
-            "x,y,yaw,v,yaw_rate,wheel_omega,"
-            "estop,system_state\n");
+        if (g_mode == Bsw::Logging::Mode::FlightRecorder) return fr_write_pending();
+        return sync_blocks() ? write_block() : drain();
+    }
+
+    void writer_main()
+    {
+        while (!g_stop.load(std::memory_order_acquire)) {
+            if (g_hold.load(std::memory_order_acquire) || write_pending() == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+        write_pending();
+    }
+
+    void stop_writer()
+    {
+        if (!g_writer.joinable()) return;
+        g_hold.store(false, std::memory_order_release);
+        g_stop.store(true, std::memory_order_release);
+        g_writer.join();
     }
 }
 
 namespace Bsw::Logging {
 
-void Init(const std::string& path)
+void Init(const std::string& path, Mode mode, Format format)
 {
+    Shutdown(); // a log still open (and its writer thread) is finished first
+    if (mode == Mode::FlightRecorder) {
+        InitFlightRecorder(path, FlightRecorderConfig{}, format);
+        return;
+    }
     std::filesystem::create_directories(std::filesystem::path(path).parent_path());
     g_fp = std::fopen(path.c_str(), "w");
     if (!g_fp) {
         std::perror("Failed to open log file");
         std::abort();
     }
-    write_header();
+    // Before any I/O on the stream, as setvbuf requires
+    std::setvbuf(g_fp, nullptr, _IOFBF, kFileBufSize);
+    g_mode = mode;
+    g_format = format;
+    g_head.store(0);
+    g_tail.store(0);
+    g_dropped.store(0);
+    g_written.store(0);
+    g_fr = FlightRecorder{};
+
+    if (g_format == Format::Columnar) {
+        g_columnar.Open(g_fp, RecordColumns());
+    } else if (g_format == Format::Compressed) {
+        g_compressed.Open(g_fp, CompressedRecordColumns());
+    } else {
+        WriteCsvHeader(g_fp);
+    }
+
+    if (sync_blocks()) {
+        for (auto& b : g_blocks) b.resize(kBlockRows);
+        g_block_cur = 0;
+        g_block_fill = 0;
+        g_handoff_rows.store(0);
+    }
+    if (g_mode == Mode::Async || sync_blocks()) {
+        g_stop.store(false);
+        g_writer = std::thread(writer_main);
+    }
+}
+
+void InitFlightRecorder(const std::string& path, const FlightRecorderConfig& cfg, Format format)
+{
+    Shutdown();
+    // A directory that cannot be created shows up as failed dumps, not as an abort
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+    g_mode = Mode::FlightRecorder;
+    g_format = format;
+    g_dropped.store(0);
+    g_written.store(0);
+    g_fr_manual.store(false);
+    g_dump_head.store(0);
+    g_dump_tail.store(0);
+    g_dumps.store(0);
+    g_dump_failures.store(0);
+
+    g_fr = FlightRecorder{};
+    g_fr.cfg = cfg;
+    g_fr.path = path;
+    g_fr.pre = std::max<uint64_t>(1, static_cast<uint64_t>(std::llround(cfg.pre_s / 0.010)));
+    g_fr.post = static_cast<uint64_t>(std::llround(std::max(cfg.post_s, 0.0) / 0.010));
+    g_fr.ring.resize(g_fr.pre + g_fr.post);
+    for (Dump& d : g_dump_slots) d.rows.resize(g_fr.ring.size());
+
+    g_stop.store(false);
+    g_writer = std::thread(writer_main);
+}
+
+void TriggerFlightRecorder() { g_fr_manual.store(true, std::memory_order_relaxed); }
+
+std::string FlightRecorderDumpPath(const std::string& path, unsigned n)
+{
+    const std::filesystem::path p(path);
+    char suffix[16];
+    std::snprintf(suffix, sizeof(suffix), "_%03u", n);
+    return (p.parent_path() / (p.stem().string() + suffix + p.extension().string())).string();
+}
+
+void Tick10ms(const Rte::Context& ctx)
+{
+    if (g_mode == Mode::FlightRecorder) {
+        if (!g_fr.ring.empty()) fr_sample(capture(ctx));
+        return;
+    }
+    if (!g_fp) return;
+
+    const Record r = capture(ctx);
+
+    if (sync_blocks()) {
+        g_blocks[g_block_cur][g_block_fill] = r;
+        if (++g_block_fill == kBlockRows) hand_off_block();
+        return;
+    }
+    if (g_mode == Mode::Sync) {
+        write_record(r);
+        g_written.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const uint64_t head = g_head.load(std::memory_order_relaxed);
+    if (head - g_tail.load(std::memory_order_acquire) >= kRingSize) {
+        g_dropped.fetch_add(1, std::memory_order_relaxed); // backpressure: never block the 10ms task
+        return;
+    }
+    g_ring[head & kRingMask] = r;
+    g_head.store(head + 1, std::memory_order_release);
 }
 
-void Tick10ms()
+void Tick10ms() { Tick10ms(Rte::DefaultContext()); }
+
+void Shutdown()
 {
+    if (g_mode == Mode::FlightRecorder) {
+        if (g_fr.window_open) {
+            // Off the 10ms path: wait for a free slot rather than lose the last window
+            g_hold.store(false, std::memory_order_release);
+            while (g_dump_head.load(std::memory_order_relaxed) - g_dump_tail.load(std::memory_order_acquire) >=
+                   kDumpSlots) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            fr_close_window();
+        }
+        stop_writer();
+        const uint64_t failures = g_dump_failures.load();
+        if (failures > 0) {
+            std::fprintf(stderr, "Logging: %llu flight recorder window(s) not written\n",
+                         static_cast<unsigned long long>(failures));
+        }
+        g_fr.ring = std::vector<Record>{}; // release the preallocated window
+        for (Dump& d : g_dump_slots) d.rows = std::vector<Record>{};
+        g_mode = Mode::Sync;
+        return;
+    }
     if (!g_fp) return;
 
-    const auto in = Rte::Rte_Read_DriverInput();
-    const auto cmd = Rte::Rte_Read_ActuatorCmd();
-    const auto st = Rte::Rte_Read_VehicleState();
-    const auto sf = Rte::Rte_Read_Safety();
+    if (sync_blocks() && g_block_fill > 0) {
+        g_hold.store(false, std::memory_order_release);
+        hand_off_block(); // the partial last block
+    }
+    stop_writer();
+    const uint64_t dropped = g_dropped.load();
+    if (dropped > 0) {
+        std::fprintf(stderr, "Logging: %llu record(s) dropped (writer could not keep up)\n",
+                     static_cast<unsigned long long>(dropped));
+    }
+    if (g_format == Format::Columnar) {
+        g_columnar.Close(); // writes the partial last chunk
+    } else if (g_format == Format::Compressed) {
+        g_compressed.Close(); // writes the partial last block
+    } else {
+        std::fclose(g_fp);
+    }
+    g_fp = nullptr;
+    for (auto& b : g_blocks) b = std::vector<Record>{};
+}
+
+void HoldWriter(bool hold) { g_hold.store(hold, std::memory_order_release); }
+
+Stats GetStats()
+{
+    Stats s;
+    s.written = g_written.load();
+    s.dropped = g_dropped.load();
+    s.dumps = g_dumps.load();
+    s.dump_failures = g_dump_failures.load();
+    return s;
+}
+
+const std::vector<ColumnarLog::ColumnDesc>& RecordColumns()
+{
+    using ColumnarLog::ColumnType;
+#define SDV_LOG_COLUMN(field, type) ColumnarLog::ColumnDesc{#field, ColumnType::type, offsetof(Record, field)}
+    static const std::vector<ColumnarLog::ColumnDesc> columns = {
+        SDV_LOG_COLUMN(t, F32),
+        SDV_LOG_COLUMN(throttle, F32),
+        SDV_LOG_COLUMN(brake, F32),
+        SDV_LOG_COLUMN(steer, F32),
+        SDV_LOG_COLUMN(drive_accel_cmd, F32),
+        SDV_LOG_COLUMN(brake_decel_cmd, F32),
+        SDV_LOG_COLUMN(steer_angle_cmd, F32),
+        SDV_LOG_COLUMN(x, F32),
+        SDV_LOG_COLUMN(y, F32),
+        SDV_LOG_COLUMN(yaw, F32),
+        SDV_LOG_COLUMN(v, F32),
+        SDV_LOG_COLUMN(yaw_rate, F32),
+        SDV_LOG_COLUMN(wheel_omega, F32),
+        SDV_LOG_COLUMN(estop, U8),
+        SDV_LOG_COLUMN(system_state, U8),
+    };
+#undef SDV_LOG_COLUMN
+    return columns;
+}
+
+const std::vector<CompressedLog::ColumnDesc>& CompressedRecordColumns()
+{
+    // Digits after the point, as printed by WriteCsvRecord
+    static const uint8_t kDecimals[] = {3, 3, 3, 3, 3, 3, 6, 3, 3, 6, 3, 6, 3, 0, 0};
+    static const std::vector<CompressedLog::ColumnDesc> columns = [] {
+        const auto& base = RecordColumns();
+        std::vector<CompressedLog::ColumnDesc> out;
+        for (std::size_t c = 0; c < base.size(); ++c) {
+            out.push_back(CompressedLog::ColumnDesc{base[c].name, base[c].type, base[c].offset, kDecimals[c]});
+        }
+        return out;
+    }();
+    static_assert(sizeof(kDecimals) == 15, "one entry per Record column");
+    return columns;
+}
+
+void WriteCsvHeader(std::FILE* fp)
+{
+    std::fprintf(fp,
+        "t,throttle,brake,steer,"
+        "drive_accel_cmd,brake_decel_cmd,steer_angle_cmd,"
+        "x,y,yaw,v,yaw_rate,wheel_omega,"
+        "estop,system_state\n");
+}
 
-    std::fprintf(g_fp,
+void WriteCsvRecord(std::FILE* fp, const Record& r)
+{
+    std::fprintf(fp,
         "%.3f,%.3f,%.3f,%.3f,"
         "%.3f,%.3f,%.6f,"
         "%.3f,%.3f,%.6f,%.3f,%.6f,%.3f,"
         "%d,%u\n",
-        st.t, in.throttle, in.brake, in.steer,
-        cmd.drive_accel_cmd, cmd.brake_decel_cmd, cmd.steer_angle_cmd,
-        st.x, st.y, st.yaw, st.v, st.yaw_rate, st.wheel_omega,
-        sf.estop ? 1 : 0, static_cast<unsigned>(sf.system_state)
+        r.t, r.throttle, r.brake, r.steer,
+        r.drive_accel_cmd, r.brake_decel_cmd, r.steer_angle_cmd,
+        r.x, r.y, r.yaw, r.v, r.yaw_rate, r.wheel_omega,
+        static_cast<int>(r.estop), static_cast<unsigned>(r.system_state)
     );
 }
 
+bool ColumnarToCsv(const std::string& in_path, const std::string& out_path, std::string& err)
+{
+    ColumnarLog::Reader reader;
+    if (!reader.Open(in_path, err)) return false;
+
+    // Resolve every Record field by name so column order in the file does not matter
+    const auto& columns = RecordColumns();
+    std::vector<int> index(columns.size());
+    for (std::size_t c = 0; c < columns.size(); ++c) {
+        index[c] = reader.FindColumn(columns[c].name);
+        if (index[c] < 0 || reader.Column(static_cast<std::size_t>(index[c])).type != columns[c].type) {
+            err = in_path + ": missing or mistyped column '" + columns[c].name + "'";
+            return false;
+        }
+    }
+
+    std::FILE* out = std::fopen(out_path.c_str(), "w");
+    if (!out) {
+        err = "cannot open " + out_path;
+        return false;
+    }
+    std::setvbuf(out, nullptr, _IOFBF, kFileBufSize);
+    WriteCsvHeader(out);
+
+    std::vector<const uint8_t*> src(columns.size());
+    for (std::size_t k = 0; k < reader.ChunkCount(); ++k) {
+        for (std::size_t c = 0; c < columns.size(); ++c) {
+            const auto col = static_cast<std::size_t>(index[c]);
+            src[c] = columns[c].type == ColumnarLog::ColumnType::F32
+                ? reinterpret_cast<const uint8_t*>(reader.ColumnSpan<float>(k, col).data)
+                : reader.ColumnSpan<uint8_t>(k, col).data;
+        }
+        for (std::size_t row = 0; row < reader.ChunkRows(k); ++row) {
+            Record r{};
+            for (std::size_t c = 0; c < columns.size(); ++c) {
+                const std::size_t sz = ColumnarLog::TypeSize(columns[c].type);
+                std::memcpy(reinterpret_cast<uint8_t*>(&r) + columns[c].offset, src[c] + row * sz, sz);
+            }
+            WriteCsvRecord(out, r);
+        }
+    }
+    std::fclose(out);
+    return true;
+}
+
+bool CompressedToCsv(const std::string& in_path, const std::string& out_path, std::string& err)
+{
+    CompressedLog::StreamReader reader;
+    if (!reader.Open(in_path, err)) return false;
+
+    const auto& columns = CompressedRecordColumns();
+    std::vector<std::size_t> index(columns.size());
+    for (std::size_t c = 0; c < columns.size(); ++c) {
+        const int i = reader.FindColumn(columns[c].name);
+        if (i < 0 || reader.Column(static_cast<std::size_t>(i)).type != columns[c].type ||
+            reader.Column(static_cast<std::size_t>(i)).decimals != columns[c].decimals) {
+            err = in_path + ": missing or mistyped column '" + columns[c].name + "'";
+            return false;
+        }
+        index[c] = static_cast<std::size_t>(i);
+    }
+
+    std::FILE* out = std::fopen(out_path.c_str(), "w");
+    if (!out) {
+        err = "cannot open " + out_path;
+        return false;
+    }
+    std::setvbuf(out, nullptr, _IOFBF, kFileBufSize);
+    WriteCsvHeader(out);
+
+    // Cells are formatted from the quantized codes; raw (unquantizable) blocks
+    // go through the same printf conversion WriteCsvRecord uses
+    char line[1024];
+    while (reader.NextBlock()) {
+        for (std::size_t row = 0; row < reader.Rows(); ++row) {
+            std::size_t len = 0;
+            for (std::size_t c = 0; c < columns.size(); ++c) {
+                const std::size_t col = index[c];
+                char* cell = line + len;
+                if (reader.IsRaw(col)) {
+                    len += static_cast<std::size_t>(std::snprintf(cell, 64, "%.*f", columns[c].decimals,
+                        static_cast<double>(reader.RawValues(col)[row])));
+                } else {
+                    len += static_cast<std::size_t>(
+                        CompressedLog::FormatCode(reader.Codes(col)[row], columns[c].decimals, cell));
+                }
+                line[len++] = c + 1 < columns.size() ? ',' : '\n';
+            }
+            std::fwrite(line, 1, len, out);
+        }
+    }
+    std::fclose(out);
+    if (!reader.Error().empty()) {
+        err = in_path + ": " + reader.Error();
+        return false;
+    }
+    return true;
+}
+
 } // namespace Bsw::Logging
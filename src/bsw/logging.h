@@ -1,9 +1,101 @@
 #pragma once
+#include <cstdint>
+#include <cstdio>
+#include <functional>
 #include <string>
+#include <vector>
 
+#include "bsw/columnar_log.h"
+#include "bsw/compressed_log.h"
+
+namespace Rte { struct Context; }
+
+// One process-wide log sink. Tick10ms(ctx) records the given RTE instance,
+// Tick10ms() the default one.
 namespace Bsw::Logging {
 
-void Init(const std::string& path);
+enum class Mode : uint8_t {
+    Sync = 0,  // format + fprintf inside Tick10ms (v1 behaviour); with Format::Compressed
+               // Tick10ms only fills a block and a writer thread encodes full blocks (lossless)
+    Async = 1, // Tick10ms only enqueues a Record; a writer thread formats/flushes
+    FlightRecorder = 2 // samples stay in RAM; only windows around triggers are written
+};
+
+enum class Format : uint8_t {
+    Csv = 0,      // logs/latest.csv text (v1 behaviour)
+    Columnar = 1, // chunked binary columns, see bsw/columnar_log.h
+    Compressed = 2 // delta/RLE/varint blocks for soak runs, see bsw/compressed_log.h
+};
+
+// One 10ms sample, captured from the RTE (POD, fixed size).
+struct Record {
+    float t;
+    float throttle, brake, steer;
+    float drive_accel_cmd, brake_decel_cmd, steer_angle_cmd;
+    float x, y, yaw, v, yaw_rate, wheel_omega;
+    uint8_t estop;
+    uint8_t system_state;
+};
+
+struct Stats {
+    uint64_t written = 0;  // records formatted to the file
+    uint64_t dropped = 0;  // records lost because the async ring was full
+    uint64_t dumps = 0;    // flight recorder windows written
+    uint64_t dump_failures = 0; // windows lost: file not writable, or every dump slot still queued
+};
+
+// Mode::FlightRecorder: a ring preallocated at Init keeps the last pre_s + post_s
+// seconds. A trigger (rising edge of any enabled condition) opens a window; after
+// post_s more seconds, the pre_s before the trigger and the post_s after it are
+// written to their own file (FlightRecorderDumpPath) by a writer thread; the
+// 10ms task only copies the closed window into one of a few preallocated slots.
+// Triggers inside an open window are covered by it. Shutdown writes an open
+// window truncated and waits for all queued windows.
+struct FlightRecorderConfig {
+    double pre_s = 10.0;
+    double post_s = 5.0;
+    bool on_estop = true;       // Safety.estop false -> true
+    bool on_fault_state = true; // system_state changes to Degraded or EStop
+    std::function<bool(const Record&)> predicate; // optional user condition
+};
+
+// Both finish a log that is still open (as Shutdown) before starting the new one
+void Init(const std::string& path, Mode mode = Mode::Sync, Format format = Format::Csv);
+void InitFlightRecorder(const std::string& path, const FlightRecorderConfig& cfg, Format format = Format::Csv);
+
+// Manual trigger, taken at the next Tick10ms (callable from any thread)
+void TriggerFlightRecorder();
+
+// File of the n-th window (0-based): "logs/latest.csv" -> "logs/latest_000.csv"
+std::string FlightRecorderDumpPath(const std::string& path, unsigned n);
+void Tick10ms(const Rte::Context& ctx);
 void Tick10ms();
 
+// Drains pending records (async), flushes and closes the file.
+void Shutdown();
+
+// Mode::Async / FlightRecorder: while held, the writer thread drains nothing, so
+// the ring (dump slots) fills and further records (windows) are dropped exactly
+// as with a slow disk (tests, fault injection). Shutdown releases the hold before draining.
+void HoldWriter(bool hold);
+
+Stats GetStats();
+
+// Typed schema of Record: one column per CSV header field, same names/order
+const std::vector<ColumnarLog::ColumnDesc>& RecordColumns();
+
+// Record schema with the CSV precision of every column (Format::Compressed)
+const std::vector<CompressedLog::ColumnDesc>& CompressedRecordColumns();
+
+// The CSV formatting used by Format::Csv
+void WriteCsvHeader(std::FILE* fp);
+void WriteCsvRecord(std::FILE* fp, const Record& r);
+
+// Rewrites a Format::Columnar log as the CSV Format::Csv would have produced
+// (byte-identical). Returns false and sets err on failure.
+bool ColumnarToCsv(const std::string& in_path, const std::string& out_path, std::string& err);
+
+// Same for a Format::Compressed log (also byte-identical: values are kept at CSV precision)
+bool CompressedToCsv(const std::string& in_path, const std::string& out_path, std::string& err);
+
 } // namespace Bsw::Logging
@@ -0,0 +1,94 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Bsw::TimeBase {
+
+/**
+ * @brief Fixed-size log-linear (HDR-style) latency histogram in nanoseconds
+ *
+ * Values are bucketed by power of two with kSubBuckets linear steps inside
+ * each power, i.e. relative error <= 1/kSubBuckets (12.5%) over 1ns..~137s.
+ * Record() is a few integer ops and never allocates; exact min/max are kept
+ * separately so the observed WCET is not quantized.
+ */
+class LatencyHistogram {
+public:
+    static constexpr std::size_t kSubBits = 3;
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBits;
+    static constexpr std::size_t kMagnitudes = 35;
+    static constexpr std::size_t kBuckets = kMagnitudes * kSubBuckets;
+
+    void Record(int64_t ns)
+    {
+        const uint64_t v = ns > 0 ? static_cast<uint64_t>(ns) : 0;
+        ++counts_[BucketOf(v)];
+        ++count_;
+        sum_ += v;
+        if (v < min_) min_ = v;
+        if (v > max_) max_ = v;
+    }
+
+    uint64_t Count() const { return count_; }
+    uint64_t MinNs() const { return count_ ? min_ : 0; }
+    uint64_t MaxNs() const { return max_; } // observed WCET
+    double MeanNs() const { return count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0; }
+
+    // Upper edge of the bucket holding the q-quantile (0..1), clamped to the observed max
+    uint64_t QuantileNs(double q) const
+    {
+        if (count_ == 0) return 0;
+        const auto rank = static_cast<uint64_t>(q * static_cast<double>(count_ - 1)) + 1;
+        uint64_t acc = 0;
+        for (std::size_t b = 0; b < kBuckets; ++b) {
+            acc += counts_[b];
+            if (acc >= rank) {
+                const uint64_t hi = UpperEdge(b);
+                return hi < max_ ? hi : max_;
+            }
+        }
+        return max_;
+    }
+
+    void Reset() { *this = LatencyHistogram{}; }
+
+private:
+    static std::size_t BucketOf(uint64_t v)
+    {
+        if (v < kSubBuckets) return static_cast<std::size_t>(v);
+        const std::size_t msb = 63 - static_cast<std::size_t>(CountLeadingZeros(v));
+        const std::size_t mag = msb - kSubBits + 1;
+        const std::size_t sub = static_cast<std::size_t>(v >> (msb - kSubBits)) & (kSubBuckets - 1);
+        const std::size_t b = mag * kSubBuckets + sub;
+        return b < kBuckets ? b : kBuckets - 1;
+    }
+
+    static uint64_t UpperEdge(std::size_t b)
+    {
+        const std::size_t mag = b / kSubBuckets;
+        const uint64_t sub = b % kSubBuckets;
+        if (mag == 0) return sub;
+        const std::size_t shift = mag - 1;
+        return ((kSubBuckets + sub + 1) << shift) - 1;
+    }
+
+    static int CountLeadingZeros(uint64_t v)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll(v);
+#else
+        int n = 0;
+        for (uint64_t bit = uint64_t{1} << 63; (v & bit) == 0; bit >>= 1) ++n;
+        return n;
+#endif
+    }
+
+    std::array<uint64_t, kBuckets> counts_{};
+    uint64_t count_ = 0;
+    uint64_t sum_ = 0;
+    uint64_t min_ = UINT64_MAX;
+    uint64_t max_ = 0;
+};
+
+} // namespace Bsw::TimeBase
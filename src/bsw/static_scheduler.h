@@ -0,0 +1,95 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Bsw::TimeBase {
+
+/**
+ * @brief Compile-time list of runnables for one rate class
+ *
+ * Each entry is a function (pointer) known at compile time, so calls are
+ * direct and can be inlined. All entries must accept the same arguments
+ * that are passed to StaticScheduler::RunForSeconds (none, or e.g. a context).
+ *
+ * @code
+ * using Tasks10ms = TaskList<&Task_Engine, &Task_Brake, &Task_Plant>;
+ * @endcode
+ */
+template <auto... Fns>
+struct TaskList {
+    static constexpr std::size_t kSize = sizeof...(Fns);
+
+    template <typename... Args>
+    static void Run(Args&... args)
+    {
+        if constexpr (kSize == 0) {
+            ((void)args, ...);
+        } else {
+            (Fns(args...), ...);
+        }
+    }
+
+    // f(fn, index) for every entry, in order (e.g. to register them one by one)
+    template <typename F>
+    static void ForEach(F&& f)
+    {
+        std::size_t i = 0;
+        ((f(Fns, i++)), ...);
+    }
+};
+
+/**
+ * @brief Statically configured 10/20/100ms scheduler
+ *
+ * Same semantics as Scheduler::RunForSeconds (10ms tasks first, then 20ms on
+ * even ticks, then 100ms every 10th tick), but the 100ms hyperperiod is
+ * unrolled at compile time: there is no modulo and no indirect call per tick.
+ */
+template <typename Tasks10ms, typename Tasks20ms, typename Tasks100ms>
+class StaticScheduler {
+public:
+    static constexpr std::size_t kTicksPerHyperperiod = 10; // 100ms / 10ms
+
+    template <typename... Args>
+    static void RunForSeconds(double seconds, Args&... args)
+    {
+        const int64_t steps10ms = static_cast<int64_t>(std::round(seconds / 0.010));
+        const int64_t periods = steps10ms / static_cast<int64_t>(kTicksPerHyperperiod);
+        const int64_t rest = steps10ms % static_cast<int64_t>(kTicksPerHyperperiod);
+
+        for (int64_t h = 0; h < periods; ++h) {
+            RunHyperperiod(std::make_index_sequence<kTicksPerHyperperiod>{}, args...);
+        }
+        RunPartial(rest, std::make_index_sequence<kTicksPerHyperperiod>{}, args...);
+    }
+
+private:
+    template <std::size_t K, typename... Args>
+    static void RunTick(Args&... args)
+    {
+        Tasks10ms::Run(args...);
+        if constexpr ((K % 2) == 0) { // 20ms
+            Tasks20ms::Run(args...);
+        }
+        if constexpr (K == 0) {       // 100ms
+            Tasks100ms::Run(args...);
+        }
+    }
+
+    template <std::size_t... K, typename... Args>
+    static void RunHyperperiod(std::index_sequence<K...>, Args&... args)
+    {
+        (RunTick<K>(args...), ...);
+    }
+
+    // First `count` ticks of a hyperperiod (tail of a run that is not a multiple of 100ms)
+    template <std::size_t... K, typename... Args>
+    static void RunPartial(int64_t count, std::index_sequence<K...>, Args&... args)
+    {
+        ((static_cast<int64_t>(K) < count ? RunTick<K>(args...) : void()), ...);
+    }
+};
+
+} // namespace Bsw::TimeBase
@@ -0,0 +1,110 @@
+#include "bsw/task_graph.h"
+#include <cassert>
+
+namespace Bsw::TimeBase {
+
+TaskGraph::TaskGraph(unsigned workers)
+{
+    for (unsigned i = 0; i < workers; ++i) {
+        workers_.emplace_back([this] { WorkerMain(); });
+    }
+}
+
+TaskGraph::~TaskGraph()
+{
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& w : workers_) w.join();
+}
+
+TaskGraph::NodeId TaskGraph::Add(const char* name, TaskFn fn, std::initializer_list<NodeId> deps)
+{
+    const NodeId id = nodes_.size();
+    nodes_.push_back(Node{name, std::move(fn), {}, 0, 0});
+    for (const NodeId d : deps) {
+        assert(d < id && "dependency must be added first");
+        nodes_[d].successors.push_back(id);
+        ++nodes_[id].dep_count;
+    }
+    if (nodes_[id].dep_count == 0) roots_.push_back(id);
+    return id;
+}
+
+void TaskGraph::Run()
+{
+    if (workers_.empty()) {
+        // Insertion order is a valid topological order (deps are added first)
+        for (auto& n : nodes_) n.fn();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        for (auto& n : nodes_) n.pending = n.dep_count;
+        remaining_ = nodes_.size();
+        ready_.assign(roots_.begin(), roots_.end());
+    }
+    cv_.notify_all();
+
+    // The caller works too instead of only waiting
+    for (;;) {
+        if (RunReady()) continue;
+        std::unique_lock<std::mutex> lk(m_);
+        if (remaining_ == 0) break;
+        if (ready_.empty()) {
+            done_cv_.wait(lk, [this] { return remaining_ == 0 || !ready_.empty(); });
+        }
+        if (remaining_ == 0) break;
+    }
+}
+
+bool TaskGraph::RunReady()
+{
+    NodeId id;
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        if (ready_.empty()) return false;
+        id = ready_.front();
+        ready_.pop_front();
+    }
+    Execute(id);
+    return true;
+}
+
+void TaskGraph::Execute(NodeId id)
+{
+    Node& n = nodes_[id];
+    n.fn();
+
+    // Releasing successors under m_ also publishes this node's RTE writes
+    // to whichever thread picks them up.
+    std::size_t newly_ready = 0;
+    std::lock_guard<std::mutex> lk(m_);
+    for (const NodeId s : n.successors) {
+        if (--nodes_[s].pending == 0) {
+            ready_.push_back(s);
+            ++newly_ready;
+        }
+    }
+    --remaining_;
+    if (newly_ready > 1) cv_.notify_all();
+    else if (newly_ready == 1) cv_.notify_one();
+    if (remaining_ == 0 || newly_ready > 0) done_cv_.notify_one();
+}
+
+void TaskGraph::WorkerMain()
+{
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lk(m_);
+            cv_.wait(lk, [this] { return stop_ || !ready_.empty(); });
+            if (stop_) return;
+        }
+        while (RunReady()) {}
+    }
+}
+
+} // namespace Bsw::TimeBase
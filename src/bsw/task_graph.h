@@ -0,0 +1,70 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bsw/timebase.h"
+
+namespace Bsw::TimeBase {
+
+/**
+ * @brief Dependency-graph executor for the runnables of one activation
+ *
+ * Runnables are added with the nodes they depend on (data produced by them).
+ * Run() starts every node whose dependencies are done, on the calling thread
+ * plus the worker threads, and returns when all nodes have finished.
+ *
+ * Results are deterministic as long as the graph is correct: every RTE
+ * element has a single writer, and a reader depends on that writer.
+ */
+class TaskGraph {
+public:
+    using NodeId = std::size_t;
+
+    // workers: extra threads besides the caller of Run() (0 = run inline, in insertion order)
+    explicit TaskGraph(unsigned workers = 0);
+    ~TaskGraph();
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    // deps must refer to nodes added earlier (so the graph is acyclic by construction)
+    NodeId Add(const char* name, TaskFn fn, std::initializer_list<NodeId> deps = {});
+
+    void Run();
+
+    std::size_t Size() const { return nodes_.size(); }
+    const char* Name(NodeId id) const { return nodes_[id].name; }
+
+private:
+    struct Node {
+        const char* name;
+        TaskFn fn;
+        std::vector<NodeId> successors;
+        int dep_count = 0;
+        int pending = 0; // unfinished deps in the current Run(), guarded by m_
+    };
+
+    void Execute(NodeId id);
+    bool RunReady(); // runs one ready node; false if none was ready
+    void WorkerMain();
+
+    std::vector<Node> nodes_;
+    std::vector<NodeId> roots_;
+
+    std::vector<std::thread> workers_;
+    std::mutex m_;
+    std::condition_variable cv_;      // workers: ready work or stop
+    std::condition_variable done_cv_; // caller: all nodes finished
+    std::deque<NodeId> ready_;
+    std::size_t remaining_ = 0;
+    bool stop_ = false;
+};
+
+} // namespace Bsw::TimeBase
@@ -1,27 +1,418 @@
 #include "bsw/timebase.h"
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <time.h>
+#define SDV_HAVE_CLOCK_NANOSLEEP 1
+#endif
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace Bsw::TimeBase {
 
-void Scheduler::AddTask10ms(TaskFn fn)  { tasks10ms_.push_back(std::move(fn)); }
-void Scheduler::AddTask20ms(TaskFn fn)  { tasks20ms_.push_back(std::move(fn)); }
-void Scheduler::AddTask100ms(TaskFn fn) { tasks100ms_.push_back(std::move(fn)); }
+namespace {
+
+std::size_t jitter_bucket(int64_t jitter_ns)
+{
+    const int64_t us = std::max<int64_t>(jitter_ns, 0) / 1000;
+    std::size_t k = 0;
+    while ((int64_t{1} << k) <= us && k + 1 < PacingStats::kJitterBuckets) ++k;
+    return k;
+}
+
+constexpr int64_t kRateDivider[3] = {1, 2, 10}; // 10/20/100ms in 10ms ticks
+constexpr int kRateMs[3] = {10, 20, 100};
+
+// Applies affinity/priority to the calling thread
+void ApplyThreadConfig(const RateThreadConfig& c, RateThreadStats& s)
+{
+#if defined(__linux__)
+    if (c.cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(c.cpu, &set);
+        s.affinity_applied = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    }
+    if (c.fifo_priority > 0) {
+        sched_param sp{};
+        sp.sched_priority = c.fifo_priority;
+        s.priority_applied = pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp) == 0;
+    }
+#else
+    (void)c;
+    (void)s;
+#endif
+}
+
+} // namespace
+
+int64_t MonotonicNowNs()
+{
+#if defined(SDV_HAVE_CLOCK_NANOSLEEP)
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void SleepUntilNs(int64_t deadline_ns)
+{
+#if defined(SDV_HAVE_CLOCK_NANOSLEEP) && !defined(__APPLE__)
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(deadline_ns / 1000000000LL);
+    ts.tv_nsec = static_cast<long>(deadline_ns % 1000000000LL);
+    // Absolute deadline: no drift accumulates across ticks, EINTR just retries
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {}
+#else
+    const int64_t now = MonotonicNowNs();
+    if (deadline_ns > now) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(deadline_ns - now));
+    }
+#endif
+}
+
+int64_t PacingStats::JitterQuantileNs(double q) const
+{
+    if (ticks == 0) return 0;
+    const auto target = static_cast<uint64_t>(std::ceil(q * static_cast<double>(ticks)));
+    uint64_t acc = 0;
+    for (std::size_t k = 0; k < kJitterBuckets; ++k) {
+        acc += jitter_hist[k];
+        if (acc >= target) return (int64_t{1} << k) * 1000;
+    }
+    return jitter_max_ns;
+}
+
+Scheduler::Task Scheduler::MakeTask(TaskFn fn, const char* name, DataTrigger trigger)
+{
+    Task t;
+    t.fn = std::move(fn);
+    t.name = name;
+    t.trigger = std::move(trigger);
+    return t;
+}
+
+void Scheduler::AddTask10ms(TaskFn fn, const char* name, DataTrigger trigger)
+{
+    tasks10ms_.push_back(MakeTask(std::move(fn), name, std::move(trigger)));
+}
+void Scheduler::AddTask20ms(TaskFn fn, const char* name, DataTrigger trigger)
+{
+    tasks20ms_.push_back(MakeTask(std::move(fn), name, std::move(trigger)));
+}
+void Scheduler::AddTask100ms(TaskFn fn, const char* name, DataTrigger trigger)
+{
+    tasks100ms_.push_back(MakeTask(std::move(fn), name, std::move(trigger)));
+}
+
+bool Scheduler::Dispatch(Task& t)
+{
+    if (t.trigger.inputs) {
+        ++t.activations;
+        const uint64_t in = t.trigger.inputs();
+        if (t.has_run && in == t.last_inputs) {
+            ++t.skipped;
+            if (t.trigger.on_skip) t.trigger.on_skip();
+            return false;
+        }
+        t.last_inputs = in;
+        t.has_run = true;
+    }
+    t.fn();
+    return true;
+}
+
+void Scheduler::RunTasks(std::vector<Task>& tasks, int rate_idx)
+{
+#if SDV_ENABLE_PROFILING
+    // One clock read per task boundary: the end of one task starts the next
+    const int64_t start = MonotonicNowNs();
+    int64_t t0 = start;
+    for (auto& t : tasks) {
+        const bool ran = Dispatch(t);
+        const int64_t t1 = MonotonicNowNs();
+        if (ran) t.hist.Record(t1 - t0);
+        t0 = t1;
+    }
+    rate_hist_[static_cast<std::size_t>(rate_idx)].Record(t0 - start);
+#else
+    (void)rate_idx;
+    for (auto& t : tasks) Dispatch(t);
+#endif
+}
+
+void Scheduler::RunTick(int64_t i)
+{
+    if (prologue_) prologue_();
+    RunTasks(tasks10ms_, 0);
+
+    if ((i % 2) == 0) { // 20ms
+        RunTasks(tasks20ms_, 1);
+    }
+    if ((i % 10) == 0) { // 100ms
+        RunTasks(tasks100ms_, 2);
+    }
+}
 
 void Scheduler::RunForSeconds(double seconds)
 {
     // v1: Deterministic single-thread fixed-step scheduler (no real-time sleep)
     const int64_t steps10ms = static_cast<int64_t>(std::round(seconds / 0.010));
     for (int64_t i = 0; i < steps10ms; ++i) {
-        for (auto& t : tasks10ms_) t();
+        RunTick(tick_++);
+    }
+#if SDV_ENABLE_PROFILING
+    PrintProfileReport();
+#endif
+}
+
+PacingStats Scheduler::RunPaced(double seconds, const PacingConfig& cfg)
+{
+    const int64_t steps10ms = static_cast<int64_t>(std::round(seconds / 0.010));
+    const bool sleep = cfg.speed_factor > 0.0;
+
+    PacingStats s;
+    s.period_ns = sleep ? static_cast<int64_t>(std::llround(10000000.0 / cfg.speed_factor)) : 0;
+    s.jitter_min_ns = INT64_MAX;
+
+    double jitter_sum = 0.0;
+    const int64_t start = MonotonicNowNs();
+    for (int64_t i = 0; i < steps10ms; ++i) {
+        const int64_t release = start + i * s.period_ns;
+        if (sleep) SleepUntilNs(release);
+
+        const int64_t begin = MonotonicNowNs();
+        RunTick(tick_++);
+        const int64_t end = MonotonicNowNs();
+
+        const int64_t jitter = sleep ? begin - release : 0;
+        s.jitter_min_ns = std::min(s.jitter_min_ns, jitter);
+        s.jitter_max_ns = std::max(s.jitter_max_ns, jitter);
+        jitter_sum += static_cast<double>(jitter);
+        ++s.jitter_hist[jitter_bucket(jitter)];
+        s.exec_max_ns = std::max(s.exec_max_ns, end - begin);
+        if (sleep && end > release + s.period_ns) ++s.overruns;
+        ++s.ticks;
+    }
+
+    if (s.ticks == 0) s.jitter_min_ns = 0;
+    s.jitter_mean_ns = s.ticks ? jitter_sum / static_cast<double>(s.ticks) : 0.0;
+    if (cfg.print_report) PrintPacingReport(s);
+#if SDV_ENABLE_PROFILING
+    PrintProfileReport();
+#endif
+    return s;
+}
+
+ThreadedStats Scheduler::RunThreaded(double seconds, const ThreadedConfig& cfg)
+{
+    const int64_t first = tick_;
+    const int64_t end = first + static_cast<int64_t>(std::round(seconds / 0.010));
+    const bool det = cfg.deterministic;
+    const double speed = (det || cfg.speed_factor > 0.0) ? cfg.speed_factor : 1.0;
+
+    ThreadedStats st;
+    st.deterministic = det;
+    st.period_ns = speed > 0.0 ? static_cast<int64_t>(std::llround(10000000.0 / speed)) : 0;
+    std::vector<Task>* tasks[3] = {&tasks10ms_, &tasks20ms_, &tasks100ms_};
+
+    // Shared with the workers, guarded by m. Deterministic mode passes a baton:
+    // `turn` names the only rate allowed to run, for tick `cur`.
+    constexpr int kDone = -1;
+    std::mutex m;
+    std::condition_variable cv;
+    int ready = 0;
+    bool go = false;
+    int64_t start = 0;
+    int turn = 0;
+    int64_t cur = first;
+
+    auto activate = [&](int r, int64_t i) {
+        const int64_t release = start + (i - first) * st.period_ns;
+        const int64_t begin = MonotonicNowNs();
+        if (r == 0 && prologue_) prologue_();
+        RunTasks(*tasks[r], r);
+        const int64_t done = MonotonicNowNs();
+
+        auto& rs = st.rates[static_cast<std::size_t>(r)];
+        ++rs.activations;
+        rs.exec_max_ns = std::max(rs.exec_max_ns, done - begin);
+        if (st.period_ns > 0 && done > release + kRateDivider[r] * st.period_ns) ++rs.overruns;
+    };
+
+    auto worker = [&](int r) {
+        ApplyThreadConfig(cfg.rates[static_cast<std::size_t>(r)], st.rates[static_cast<std::size_t>(r)]);
+        {
+            std::unique_lock<std::mutex> lk(m);
+            ++ready;
+            cv.notify_all();
+            cv.wait(lk, [&] { return go; });
+        }
+
+        if (!det) {
+            const int64_t div = kRateDivider[r];
+            for (int64_t i = first + (div - first % div) % div; i < end; i += div) {
+                if (st.period_ns > 0) SleepUntilNs(start + (i - first) * st.period_ns);
+                activate(r, i);
+            }
+            return;
+        }
+
+        if (r == 0) {
+            // The 10ms thread leads: it runs its tick, then hands the baton to the
+            // 20ms and 100ms threads in order and waits for it to come back.
+            for (int64_t i = first; i < end; ++i) {
+                if (st.period_ns > 0) SleepUntilNs(start + (i - first) * st.period_ns);
+                activate(0, i);
+                if ((i % 2) != 0) continue;
+                std::unique_lock<std::mutex> lk(m);
+                cur = i;
+                turn = 1;
+                cv.notify_all();
+                cv.wait(lk, [&] { return turn == 0; });
+            }
+            std::lock_guard<std::mutex> lk(m);
+            turn = kDone;
+            cv.notify_all();
+            return;
+        }
+
+        for (;;) {
+            int64_t i = 0;
+            {
+                std::unique_lock<std::mutex> lk(m);
+                cv.wait(lk, [&] { return turn == r || turn == kDone; });
+                if (turn == kDone) return;
+                i = cur;
+            }
+            activate(r, i);
+            std::lock_guard<std::mutex> lk(m);
+            turn = (r == 1 && (i % 10) == 0) ? 2 : 0;
+            cv.notify_all();
+        }
+    };
 
-        if ((i % 2) == 0) { // 20ms
-            for (auto& t : tasks20ms_) t();
+    std::vector<std::thread> threads;
+    for (int r = 0; r < 3; ++r) threads.emplace_back(worker, r);
+    {
+        // Common time origin once every thread has its placement applied
+        std::unique_lock<std::mutex> lk(m);
+        cv.wait(lk, [&] { return ready == 3; });
+        start = MonotonicNowNs();
+        go = true;
+        cv.notify_all();
+    }
+    for (auto& t : threads) t.join();
+    tick_ = end;
+
+    if (cfg.print_report) PrintThreadedReport(st, cfg);
+#if SDV_ENABLE_PROFILING
+    PrintProfileReport();
+#endif
+    return st;
+}
+
+void PrintPacingReport(const PacingStats& s)
+{
+    std::printf("Pacing: %llu ticks, period %.3f ms, overruns %llu\n",
+        static_cast<unsigned long long>(s.ticks), static_cast<double>(s.period_ns) / 1e6,
+        static_cast<unsigned long long>(s.overruns));
+    std::printf("  release jitter [us]: min %.1f  mean %.1f  p99 <%.0f  max %.1f\n",
+        static_cast<double>(s.jitter_min_ns) / 1e3, s.jitter_mean_ns / 1e3,
+        static_cast<double>(s.JitterQuantileNs(0.99)) / 1e3, static_cast<double>(s.jitter_max_ns) / 1e3);
+    std::printf("  max tick execution [us]: %.1f\n", static_cast<double>(s.exec_max_ns) / 1e3);
+}
+
+void PrintThreadedReport(const ThreadedStats& s, const ThreadedConfig& cfg)
+{
+    std::printf("Threaded executor (%s): period %.3f ms\n",
+        s.deterministic ? "deterministic" : "free-running", static_cast<double>(s.period_ns) / 1e6);
+    for (std::size_t r = 0; r < 3; ++r) {
+        const auto& rs = s.rates[r];
+        const auto& rc = cfg.rates[r];
+        std::printf("  %3dms: %llu activations, overruns %llu, max exec %.1f us",
+            kRateMs[r], static_cast<unsigned long long>(rs.activations),
+            static_cast<unsigned long long>(rs.overruns), static_cast<double>(rs.exec_max_ns) / 1e3);
+        if (rc.cpu >= 0) std::printf(", cpu %d%s", rc.cpu, rs.affinity_applied ? "" : " (not applied)");
+        if (rc.fifo_priority > 0) {
+            std::printf(", SCHED_FIFO %d%s", rc.fifo_priority, rs.priority_applied ? "" : " (not applied)");
         }
-        if ((i % 10) == 0) { // 100ms
-            for (auto& t : tasks100ms_) t();
+        std::printf("\n");
+    }
+}
+
+std::vector<TriggerStats> Scheduler::Triggers() const
+{
+    std::vector<TriggerStats> out;
+    const std::vector<Task>* rates[3] = {&tasks10ms_, &tasks20ms_, &tasks100ms_};
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (const auto& t : *rates[r]) {
+            if (t.trigger.inputs) out.push_back(TriggerStats{t.name, kRateMs[r], t.activations, t.skipped});
         }
     }
+    return out;
+}
+
+void Scheduler::PrintTriggerReport() const
+{
+    std::printf("Data-received triggers:\n");
+    uint64_t due = 0;
+    uint64_t skipped = 0;
+    for (const auto& t : Triggers()) {
+        std::printf("  %-26s %3dms %9llu due %9llu skipped (%.1f%%)\n", t.name, t.rate_ms,
+            static_cast<unsigned long long>(t.activations), static_cast<unsigned long long>(t.skipped),
+            t.activations ? 100.0 * static_cast<double>(t.skipped) / static_cast<double>(t.activations) : 0.0);
+        due += t.activations;
+        skipped += t.skipped;
+    }
+    std::printf("  total: %llu of %llu invocations skipped\n",
+        static_cast<unsigned long long>(skipped), static_cast<unsigned long long>(due));
+}
+
+#if SDV_ENABLE_PROFILING
+std::vector<RunnableProfile> Scheduler::Profile() const
+{
+    std::vector<RunnableProfile> out;
+    const std::vector<Task>* rates[3] = {&tasks10ms_, &tasks20ms_, &tasks100ms_};
+    const char* totals[3] = {"[10ms total]", "[20ms total]", "[100ms total]"};
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (const auto& t : *rates[r]) out.push_back(RunnableProfile{t.name, kRateMs[r], t.hist});
+    }
+    for (std::size_t r = 0; r < 3; ++r) {
+        out.push_back(RunnableProfile{totals[r], kRateMs[r], rate_hist_[r]});
+    }
+    return out;
+}
+
+void Scheduler::PrintProfileReport() const
+{
+    std::printf("Runnable profile [us]:\n");
+    std::printf("  %-26s %5s %9s %8s %8s %8s %8s %8s\n",
+        "runnable", "rate", "count", "min", "mean", "p99", "p99.9", "wcet");
+    for (const auto& p : Profile()) {
+        if (p.hist.Count() == 0) continue;
+        std::printf("  %-26s %3dms %9llu %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+            p.name, p.rate_ms, static_cast<unsigned long long>(p.hist.Count()),
+            static_cast<double>(p.hist.MinNs()) / 1e3, p.hist.MeanNs() / 1e3,
+            static_cast<double>(p.hist.QuantileNs(0.99)) / 1e3,
+            static_cast<double>(p.hist.QuantileNs(0.999)) / 1e3,
+            static_cast<double>(p.hist.MaxNs()) / 1e3);
+    }
 }
+#endif
 
 } // namespace Bsw::TimeBase
@@ -1,23 +1,179 @@
 #pragma once
+#include <array>
+#include <cstdint>
 #include <functional>
+#include <utility>
 #include <vector>
 
+#include "bsw/profiler.h"
+
+// Per-runnable execution-time profiling (CMake option SDV_ENABLE_PROFILING).
+// When 0, tasks carry no profiling data and RunTick has no timestamps at all.
+#ifndef SDV_ENABLE_PROFILING
+#define SDV_ENABLE_PROFILING 0
+#endif
+
 namespace Bsw::TimeBase {
 
 using TaskFn = std::function<void()>;
 
+// Monotonic clock (CLOCK_MONOTONIC on POSIX), nanoseconds since an arbitrary epoch
+int64_t MonotonicNowNs();
+// Sleeps until the absolute monotonic time deadline_ns (returns at once if already passed)
+void SleepUntilNs(int64_t deadline_ns);
+
+struct PacingConfig {
+    // Simulated seconds per wall-clock second: 1 = real time, 10 = 10x faster,
+    // <= 0 = as fast as possible (no sleeping, jitter/overruns still measured)
+    double speed_factor = 1.0;
+    bool print_report = true;
+};
+
+struct PacingStats {
+    // Release jitter = actual start of a tick - its absolute release time.
+    // Bucket k counts jitter in [2^(k-1), 2^k) us; bucket 0 is < 1 us.
+    static constexpr std::size_t kJitterBuckets = 24;
+
+    uint64_t ticks = 0;
+    uint64_t overruns = 0;     // ticks whose work ended after the next release time
+    int64_t period_ns = 0;     // wall-clock period of one 10ms tick after scaling
+    int64_t jitter_min_ns = 0;
+    int64_t jitter_max_ns = 0;
+    double jitter_mean_ns = 0.0;
+    int64_t exec_max_ns = 0;   // longest tick (all tasks of that tick)
+    std::array<uint64_t, kJitterBuckets> jitter_hist{};
+
+    // Upper bound (ns) of the bucket that contains the q-quantile (0..1) of jitter
+    int64_t JitterQuantileNs(double q) const;
+};
+
+// Placement of one rate-class thread for Scheduler::RunThreaded (applied on Linux only)
+struct RateThreadConfig {
+    int cpu = -1;          // pin the thread to this CPU (-1 = no affinity)
+    int fifo_priority = 0; // SCHED_FIFO priority 1..99 (0 = keep the default policy)
+};
+
+struct ThreadedConfig {
+    // true: rate boundaries are synchronized so every tick runs prologue, 10ms,
+    //   20ms, 100ms in the single-thread order (bit-identical to RunForSeconds).
+    // false: every rate is released by the wall clock on its own and runs
+    //   concurrently with the others; shared data must be thread-safe
+    //   (Rte::kThreadSafePorts) and the prologue may only touch 10ms-owned data.
+    bool deterministic = true;
+    // Simulated seconds per wall-clock second as in PacingConfig; <= 0 = as fast
+    // as possible in deterministic mode, real time (1.0) in free-running mode
+    double speed_factor = 0.0;
+    std::array<RateThreadConfig, 3> rates{}; // 10/20/100ms
+    bool print_report = true;
+};
+
+struct RateThreadStats {
+    uint64_t activations = 0;
+    uint64_t overruns = 0;  // activations that ended after the next release of the same rate
+    int64_t exec_max_ns = 0;
+    bool affinity_applied = false;
+    bool priority_applied = false;
+};
+
+struct ThreadedStats {
+    bool deterministic = true;
+    int64_t period_ns = 0; // wall-clock period of one 10ms tick (0 = unpaced)
+    std::array<RateThreadStats, 3> rates{}; // 10/20/100ms
+};
+
+struct RunnableProfile {
+    const char* name;
+    int rate_ms;
+    LatencyHistogram hist;
+};
+
+// Data-received triggering (AUTOSAR DataReceivedEvent) for one task: at each
+// activation of its rate the task runs only if inputs() differs from the value
+// at its previous run (it always runs on its first activation). A skipped
+// activation calls on_skip instead, e.g. to keep alive supervision fed.
+struct DataTrigger {
+    std::function<uint64_t()> inputs; // combined update sequence of the declared inputs
+    TaskFn on_skip;
+};
+
+// Invocation counts of one data-triggered task
+struct TriggerStats {
+    const char* name;
+    int rate_ms;
+    uint64_t activations; // times the task was due
+    uint64_t skipped;     // of which the inputs were unchanged
+};
+
 class Scheduler {
 public:
-    void AddTask10ms(TaskFn fn);
-    void AddTask20ms(TaskFn fn);
-    void AddTask100ms(TaskFn fn);
+    // name is used by the profiling and trigger reports; without a trigger the
+    // task runs at every activation of its rate (periodic)
+    void AddTask10ms(TaskFn fn, const char* name = "task10ms", DataTrigger trigger = {});
+    void AddTask20ms(TaskFn fn, const char* name = "task20ms", DataTrigger trigger = {});
+    void AddTask100ms(TaskFn fn, const char* name = "task100ms", DataTrigger trigger = {});
+
+    // Runs before the tasks of every tick, e.g. to swap in a new calibration set
+    // at a tick boundary (see bsw/calib_store.h). Not part of the profile.
+    void SetTickPrologue(TaskFn fn) { prologue_ = std::move(fn); }
 
+    // Runs round(seconds / 10ms) ticks, continuing from Tick()
     void RunForSeconds(double seconds);
 
+    // Same task order as RunForSeconds, but every 10ms tick is released on the
+    // monotonic wall clock at an absolute deadline (start + k * period).
+    PacingStats RunPaced(double seconds, const PacingConfig& cfg = PacingConfig{});
+
+    // Runs the same ticks with each rate class (10/20/100ms) on its own worker
+    // thread, optionally pinned and with SCHED_FIFO priority (see ThreadedConfig).
+    // Affinity/priority failures (e.g. missing CAP_SYS_NICE) are reported in the
+    // stats and the run continues with the default placement.
+    ThreadedStats RunThreaded(double seconds, const ThreadedConfig& cfg = ThreadedConfig{});
+
+    // Number of 10ms ticks run so far; it selects the 20ms/100ms phase, so a run
+    // restored from a snapshot must set it back (see app/snapshot.h)
+    int64_t Tick() const { return tick_; }
+    void SetTick(int64_t tick) { tick_ = tick; }
+
+    // Data-triggered tasks only, in registration order (counts accumulate over runs)
+    std::vector<TriggerStats> Triggers() const;
+    void PrintTriggerReport() const;
+
+#if SDV_ENABLE_PROFILING
+    // Per-runnable entries followed by one "<rate> total" entry per rate
+    std::vector<RunnableProfile> Profile() const;
+    void PrintProfileReport() const;
+#endif
+
 private:
-    std::vector<TaskFn> tasks10ms_;
-    std::vector<TaskFn> tasks20ms_;
-    std::vector<TaskFn> tasks100ms_;
+    struct Task {
+        TaskFn fn;
+        const char* name;
+        DataTrigger trigger;
+        uint64_t last_inputs = 0;
+        bool has_run = false;
+        uint64_t activations = 0;
+        uint64_t skipped = 0;
+#if SDV_ENABLE_PROFILING
+        LatencyHistogram hist;
+#endif
+    };
+
+    static Task MakeTask(TaskFn fn, const char* name, DataTrigger trigger);
+    static bool Dispatch(Task& t); // false if a data trigger skipped it
+    void RunTasks(std::vector<Task>& tasks, int rate_idx);
+    void RunTick(int64_t i);
+
+    std::vector<Task> tasks10ms_;
+    std::vector<Task> tasks20ms_;
+    std::vector<Task> tasks100ms_;
+    int64_t tick_ = 0;
+    TaskFn prologue_;
+#if SDV_ENABLE_PROFILING
+    std::array<LatencyHistogram, 3> rate_hist_{}; // 10/20/100ms, whole activation
+#endif
 };
 
+void PrintPacingReport(const PacingStats& s);
+void PrintThreadedReport(const ThreadedStats& s, const ThreadedConfig& cfg);
+
 } // namespace Bsw::TimeBase
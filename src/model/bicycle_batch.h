@@ -0,0 +1,119 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "model/bicycle_model.h"
+
+namespace Model {
+
+/**
+ * @brief Structure-of-arrays state for N vehicles sharing one BicycleParams set
+ *
+ * Each field of BicycleState is stored as its own contiguous array so the
+ * step kernel can stream through memory with unit stride.
+ */
+struct BicycleBatch {
+    float t = 0.0f; ///< s (all vehicles advance on the same clock)
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> yaw;
+    std::vector<float> v;
+    std::vector<float> yaw_rate;
+    std::vector<float> wheel_omega;
+
+    BicycleBatch() = default;
+    explicit BicycleBatch(std::size_t n) { Resize(n); }
+
+    std::size_t Size() const { return v.size(); }
+
+    void Resize(std::size_t n)
+    {
+        x.resize(n, 0.0f);
+        y.resize(n, 0.0f);
+        yaw.resize(n, 0.0f);
+        v.resize(n, 0.0f);
+        yaw_rate.resize(n, 0.0f);
+        wheel_omega.resize(n, 0.0f);
+    }
+
+    BicycleState Get(std::size_t i) const
+    {
+        return BicycleState{x[i], y[i], yaw[i], v[i], yaw_rate[i], wheel_omega[i]};
+    }
+
+    void Set(std::size_t i, const BicycleState& s)
+    {
+        x[i] = s.x;
+        y[i] = s.y;
+        yaw[i] = s.yaw;
+        v[i] = s.v;
+        yaw_rate[i] = s.yaw_rate;
+        wheel_omega[i] = s.wheel_omega;
+    }
+};
+
+/**
+ * @brief Per-vehicle actuator commands for one batched step (views, not owned)
+ *
+ * All arrays must hold at least BicycleBatch::Size() elements.
+ * estop uses uint8_t (0/1) instead of bool so it can be vector-loaded.
+ */
+struct BicycleBatchInput {
+    const float* drive_accel_cmd = nullptr;
+    const float* brake_decel_cmd = nullptr;
+    const float* steer_angle_cmd = nullptr;
+    const uint8_t* estop = nullptr;
+};
+
+/**
+ * @brief Advance every vehicle in the batch by dt
+ *
+ * Split into two passes so the compiler can vectorize the first one:
+ *  1. longitudinal (speed, clamp, wheel speed) - pure arithmetic
+ *  2. lateral/pose (tan/cos/sin) - libm bound
+ *
+ * Per vehicle the expression sequence is identical to StepBicycle(), so a
+ * batch of one reproduces the scalar path bit for bit.
+ */
+inline void StepBicycleBatch(BicycleBatch& b, float dt, const BicycleBatchInput& in,
+                             const BicycleParams& p)
+{
+    const std::size_t n = b.Size();
+    float* __restrict v = b.v.data();
+    float* __restrict omega = b.wheel_omega.data();
+    const float* __restrict drive = in.drive_accel_cmd;
+    const float* __restrict brake = in.brake_decel_cmd;
+    const uint8_t* __restrict estop = in.estop;
+
+    const float drag = p.linear_drag;
+    const float estop_decel = p.estop_decel_mps2;
+    const float vmax = p.max_speed_mps;
+    const float r = std::max(p.wheel_radius_m, 1e-4f);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        float accel = drive[i] - brake[i] - drag * v[i];
+        accel = estop[i] ? accel - estop_decel : accel;
+        const float vn = v[i] + accel * dt;
+        v[i] = std::clamp(vn, 0.0f, vmax);
+        omega[i] = v[i] / r;
+    }
+
+    float* __restrict x = b.x.data();
+    float* __restrict y = b.y.data();
+    float* __restrict yaw = b.yaw.data();
+    float* __restrict yaw_rate = b.yaw_rate.data();
+    const float* __restrict steer = in.steer_angle_cmd;
+    const float L = std::max(p.wheelbase_m, 1e-3f);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        yaw_rate[i] = (v[i] / L) * std::tan(steer[i]);
+        yaw[i] = yaw[i] + yaw_rate[i] * dt;
+        x[i] = x[i] + v[i] * std::cos(yaw[i]) * dt;
+        y[i] = y[i] + v[i] * std::sin(yaw[i]) * dt;
+    }
+
+    b.t = b.t + dt;
+}
+
+} // namespace Model
@@ -0,0 +1,132 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+
+#include "model/integrators.h"
+
+namespace Model {
+
+/**
+ * @brief Plant parameters for the kinematic bicycle model (VehicleDynamicsSWC)
+ */
+struct BicycleParams {
+    float wheel_radius_m   = 0.03f; ///< 3cm (toy-scale placeholder)
+    float wheelbase_m      = 0.20f; ///< 20cm
+    float linear_drag      = 0.15f; ///< simple resist coefficient
+    float max_speed_mps    = 3.0f;  ///< cap for v1
+    float estop_decel_mps2 = 6.0f;  ///< extra forced decel when estop
+};
+
+/**
+ * @brief Planar pose and motion state of one vehicle
+ */
+struct BicycleState {
+    float x = 0.0f;           ///< m
+    float y = 0.0f;           ///< m
+    float yaw = 0.0f;         ///< rad
+    float v = 0.0f;           ///< m/s
+    float yaw_rate = 0.0f;    ///< rad/s
+    float wheel_omega = 0.0f; ///< rad/s
+};
+
+/**
+ * @brief Longitudinal acceleration seen by the plant (linear drag + E-Stop decel)
+ */
+inline float BicycleAccel(float v, float drive_accel_cmd, float brake_decel_cmd, bool estop,
+                          const BicycleParams& p)
+{
+    float accel = drive_accel_cmd - brake_decel_cmd - p.linear_drag * v;
+    if (estop) {
+        accel -= p.estop_decel_mps2;
+    }
+    return accel;
+}
+
+/**
+ * @brief Advance one vehicle by dt with explicit Euler
+ *
+ * Speed is integrated first and clamped to [0, max_speed_mps]; the bicycle
+ * kinematics then use the updated speed (same ordering as VehicleDynamicsSWC v1).
+ *
+ * @note The batched kernel in bicycle_batch.h evaluates the exact same
+ *       expression sequence, so both paths produce bit-identical results.
+ */
+inline void StepBicycle(BicycleState& s, float dt,
+                        float drive_accel_cmd, float brake_decel_cmd, float steer_angle_cmd,
+                        bool estop, const BicycleParams& p)
+{
+    const float accel = BicycleAccel(s.v, drive_accel_cmd, brake_decel_cmd, estop, p);
+
+    s.v = s.v + accel * dt;
+    s.v = std::clamp(s.v, 0.0f, p.max_speed_mps);
+
+    // Bicycle model
+    const float L = std::max(p.wheelbase_m, 1e-3f);
+    s.yaw_rate = (s.v / L) * std::tan(steer_angle_cmd);
+    s.yaw = s.yaw + s.yaw_rate * dt;
+
+    s.x = s.x + s.v * std::cos(s.yaw) * dt;
+    s.y = s.y + s.v * std::sin(s.yaw) * dt;
+
+    const float r = std::max(p.wheel_radius_m, 1e-4f);
+    s.wheel_omega = s.v / r; // rad/s (no gear ratio)
+}
+
+/**
+ * @brief Advance one vehicle by dt with a selectable integrator
+ *
+ * Commands are held over dt (zero-order hold). SemiImplicitEuler with one
+ * sub-step is exactly StepBicycle() above. Rk4/Rk45 integrate the continuous
+ * model in double precision; speed is kept in [0, max_speed_mps] by
+ * saturating dv/dt at the bounds and projecting after every step.
+ */
+inline void StepBicycle(BicycleState& s, float dt,
+                        float drive_accel_cmd, float brake_decel_cmd, float steer_angle_cmd,
+                        bool estop, const BicycleParams& p, const IntegratorConfig& cfg)
+{
+    const int n = std::max(cfg.substeps, 1);
+    if (cfg.method == Integrator::SemiImplicitEuler) {
+        if (n == 1) {
+            StepBicycle(s, dt, drive_accel_cmd, brake_decel_cmd, steer_angle_cmd, estop, p);
+            return;
+        }
+        const float h = dt / static_cast<float>(n);
+        for (int i = 0; i < n; ++i) {
+            StepBicycle(s, h, drive_accel_cmd, brake_decel_cmd, steer_angle_cmd, estop, p);
+        }
+        return;
+    }
+
+    const double vmax = p.max_speed_mps;
+    const double a_cmd = static_cast<double>(drive_accel_cmd) - brake_decel_cmd -
+                         (estop ? static_cast<double>(p.estop_decel_mps2) : 0.0);
+    const double drag = p.linear_drag;
+    const double k = std::tan(static_cast<double>(steer_angle_cmd)) / std::max(p.wheelbase_m, 1e-3f);
+
+    // y = {x, y, yaw, v}
+    auto rhs = [&](const Ode::State<4>& y) {
+        const double v = std::clamp(y[3], 0.0, vmax);
+        double dv = a_cmd - drag * v;
+        if ((v <= 0.0 && dv < 0.0) || (v >= vmax && dv > 0.0)) dv = 0.0;
+        return Ode::State<4>{v * std::cos(y[2]), v * std::sin(y[2]), v * k, dv};
+    };
+    auto project = [&](Ode::State<4>& y) { y[3] = std::clamp(y[3], 0.0, vmax); };
+
+    Ode::State<4> y{s.x, s.y, s.yaw, s.v};
+    if (cfg.method == Integrator::Rk4) {
+        Ode::IntegrateRk4(y, dt, n, rhs, project);
+    } else {
+        Ode::IntegrateRk45(y, dt, cfg, rhs, project);
+    }
+
+    s.x = static_cast<float>(y[0]);
+    s.y = static_cast<float>(y[1]);
+    s.yaw = static_cast<float>(y[2]);
+    s.v = static_cast<float>(y[3]);
+    const float L = std::max(p.wheelbase_m, 1e-3f);
+    s.yaw_rate = (s.v / L) * std::tan(steer_angle_cmd);
+    const float r = std::max(p.wheel_radius_m, 1e-4f);
+    s.wheel_omega = s.v / r;
+}
+
+} // namespace Model
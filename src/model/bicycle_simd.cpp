@@ -0,0 +1,141 @@
+#include "model/bicycle_simd.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "model/bicycle_simd_kernel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SDV_SIMD_X86 1
+#include <emmintrin.h>
+#else
+#define SDV_SIMD_X86 0
+#endif
+
+namespace Model {
+
+namespace SimdDetail {
+
+void StepRangeScalar(const KernelArgs& a, std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i) {
+        float accel = a.drive[i] - a.brake[i] - a.drag * a.v[i];
+        accel = a.estop[i] ? accel - a.estop_decel : accel;
+        const float vn = a.v[i] + accel * a.dt;
+        a.v[i] = std::clamp(vn, 0.0f, a.vmax);
+        a.wheel_omega[i] = a.v[i] / a.r;
+
+        a.yaw_rate[i] = (a.v[i] / a.L) * FastTrig::Tan(a.steer[i]);
+        a.yaw[i] = a.yaw[i] + a.yaw_rate[i] * a.dt;
+        float s, c;
+        FastTrig::SinCos(a.yaw[i], s, c);
+        a.x[i] = a.x[i] + a.v[i] * c * a.dt;
+        a.y[i] = a.y[i] + a.v[i] * s * a.dt;
+    }
+}
+
+#if SDV_SIMD_X86
+namespace {
+
+// SSE2 is part of the x86-64 baseline, so this TU needs no extra flags
+struct Sse2 {
+    using F = __m128;
+    using I = __m128i;
+    static constexpr std::size_t kLanes = 4;
+
+    static F Load(const float* p) { return _mm_loadu_ps(p); }
+    static void Store(float* p, F v) { _mm_storeu_ps(p, v); }
+    static F Set1(float v) { return _mm_set1_ps(v); }
+    static F Add(F a, F b) { return _mm_add_ps(a, b); }
+    static F Sub(F a, F b) { return _mm_sub_ps(a, b); }
+    static F Mul(F a, F b) { return _mm_mul_ps(a, b); }
+    static F Div(F a, F b) { return _mm_div_ps(a, b); }
+    static F Min(F a, F b) { return _mm_min_ps(a, b); }
+    static F Max(F a, F b) { return _mm_max_ps(a, b); }
+    static F Xor(F a, F b) { return _mm_xor_ps(a, b); }
+    static F Select(F m, F a, F b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+    static I Set1i(int32_t v) { return _mm_set1_epi32(v); }
+    static I RoundToInt(F v) { return _mm_cvtps_epi32(v); } // MXCSR default: nearest-even
+    static F ToFloat(I v) { return _mm_cvtepi32_ps(v); }
+    static I And(I a, I b) { return _mm_and_si128(a, b); }
+    static I AddI(I a, I b) { return _mm_add_epi32(a, b); }
+    static I Shl30(I a) { return _mm_slli_epi32(a, 30); }
+    static F AsFloat(I a) { return _mm_castsi128_ps(a); }
+    static F MaskEq(I a, I b) { return _mm_castsi128_ps(_mm_cmpeq_epi32(a, b)); }
+
+    static F EstopMask(const uint8_t* p)
+    {
+        int32_t bytes;
+        std::memcpy(&bytes, p, sizeof(bytes));
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i w = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero);
+        return _mm_castsi128_ps(_mm_xor_si128(_mm_cmpeq_epi32(w, zero), _mm_set1_epi32(-1)));
+    }
+};
+
+} // namespace
+
+std::size_t StepRangeSse2(const KernelArgs& a, std::size_t n) { return StepLanes<Sse2>(a, n); }
+#endif
+
+} // namespace SimdDetail
+
+SimdLevel DetectSimdLevel()
+{
+#if SDV_SIMD_X86
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+        if (__builtin_cpu_supports("sse2")) return SimdLevel::Sse2;
+        return SimdLevel::Scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+const char* SimdLevelName(SimdLevel level)
+{
+    switch (level) {
+    case SimdLevel::Avx2: return "avx2";
+    case SimdLevel::Sse2: return "sse2";
+    case SimdLevel::Scalar: break;
+    }
+    return "scalar";
+}
+
+void StepBicycleBatchFast(BicycleBatch& b, float dt, const BicycleBatchInput& in,
+                          const BicycleParams& p, SimdLevel level)
+{
+    const SimdDetail::KernelArgs a{
+        b.x.data(), b.y.data(), b.yaw.data(), b.v.data(), b.yaw_rate.data(), b.wheel_omega.data(),
+        in.drive_accel_cmd, in.brake_decel_cmd, in.steer_angle_cmd, in.estop,
+        dt, p.linear_drag, p.estop_decel_mps2, p.max_speed_mps,
+        std::max(p.wheel_radius_m, 1e-4f), std::max(p.wheelbase_m, 1e-3f)};
+    const std::size_t n = b.Size();
+
+    std::size_t done = 0;
+#if SDV_SIMD_X86
+    level = std::min(level, DetectSimdLevel());
+    if (level == SimdLevel::Avx2) {
+        done = SimdDetail::StepRangeAvx2(a, n);
+    } else if (level == SimdLevel::Sse2) {
+        done = SimdDetail::StepRangeSse2(a, n);
+    }
+#else
+    (void)level;
+#endif
+    SimdDetail::StepRangeScalar(a, done, n);
+
+    b.t = b.t + dt;
+}
+
+void StepBicycleBatchFast(BicycleBatch& b, float dt, const BicycleBatchInput& in,
+                          const BicycleParams& p)
+{
+    StepBicycleBatchFast(b, dt, in, p, DetectSimdLevel());
+}
+
+} // namespace Model
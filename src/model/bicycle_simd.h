@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+
+#include "model/bicycle_batch.h"
+
+namespace Model {
+
+enum class SimdLevel : uint8_t {
+    Scalar = 0,
+    Sse2 = 1, // 4 lanes
+    Avx2 = 2  // 8 lanes
+};
+
+// Best level supported by this CPU/OS (Scalar on non-x86 builds)
+SimdLevel DetectSimdLevel();
+const char* SimdLevelName(SimdLevel level);
+
+/**
+ * @brief StepBicycleBatch with polynomial trig (model/fast_trig.h), vectorized
+ *
+ * Same update as StepBicycleBatch in one fused pass; only tan/sin/cos differ
+ * (bounded error, see fast_trig.h). All levels give bit-identical results, so
+ * the runtime choice never changes a simulation.
+ *
+ * @param level requested level; clamped to DetectSimdLevel()
+ */
+void StepBicycleBatchFast(BicycleBatch& b, float dt, const BicycleBatchInput& in,
+                          const BicycleParams& p, SimdLevel level);
+
+// Uses DetectSimdLevel()
+void StepBicycleBatchFast(BicycleBatch& b, float dt, const BicycleBatchInput& in,
+                          const BicycleParams& p);
+
+} // namespace Model
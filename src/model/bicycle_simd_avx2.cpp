@@ -0,0 +1,59 @@
+// Built with -mavx2 (see CMakeLists.txt); only reached after DetectSimdLevel()
+#include "model/bicycle_simd_kernel.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+namespace Model::SimdDetail {
+
+namespace {
+
+struct Avx2 {
+    using F = __m256;
+    using I = __m256i;
+    static constexpr std::size_t kLanes = 8;
+
+    static F Load(const float* p) { return _mm256_loadu_ps(p); }
+    static void Store(float* p, F v) { _mm256_storeu_ps(p, v); }
+    static F Set1(float v) { return _mm256_set1_ps(v); }
+    static F Add(F a, F b) { return _mm256_add_ps(a, b); }
+    static F Sub(F a, F b) { return _mm256_sub_ps(a, b); }
+    static F Mul(F a, F b) { return _mm256_mul_ps(a, b); }
+    static F Div(F a, F b) { return _mm256_div_ps(a, b); }
+    static F Min(F a, F b) { return _mm256_min_ps(a, b); }
+    static F Max(F a, F b) { return _mm256_max_ps(a, b); }
+    static F Xor(F a, F b) { return _mm256_xor_ps(a, b); }
+    static F Select(F m, F a, F b) { return _mm256_blendv_ps(b, a, m); }
+
+    static I Set1i(int32_t v) { return _mm256_set1_epi32(v); }
+    static I RoundToInt(F v) { return _mm256_cvtps_epi32(v); }
+    static F ToFloat(I v) { return _mm256_cvtepi32_ps(v); }
+    static I And(I a, I b) { return _mm256_and_si256(a, b); }
+    static I AddI(I a, I b) { return _mm256_add_epi32(a, b); }
+    static I Shl30(I a) { return _mm256_slli_epi32(a, 30); }
+    static F AsFloat(I a) { return _mm256_castsi256_ps(a); }
+    static F MaskEq(I a, I b) { return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)); }
+
+    static F EstopMask(const uint8_t* p)
+    {
+        const __m256i w = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+        const __m256i zero = _mm256_setzero_si256();
+        return _mm256_castsi256_ps(_mm256_xor_si256(_mm256_cmpeq_epi32(w, zero), _mm256_set1_epi32(-1)));
+    }
+};
+
+} // namespace
+
+std::size_t StepRangeAvx2(const KernelArgs& a, std::size_t n) { return StepLanes<Avx2>(a, n); }
+
+} // namespace Model::SimdDetail
+
+#else
+
+namespace Model::SimdDetail {
+// Compiler without AVX2 support: DetectSimdLevel() may still report it, so
+// process nothing and let the scalar path take every vehicle.
+std::size_t StepRangeAvx2(const KernelArgs& /*a*/, std::size_t /*n*/) { return 0; }
+}
+
+#endif
@@ -0,0 +1,114 @@
+#pragma once
+// Private to bicycle_simd*.cpp: one lane-generic kernel, instantiated per
+// instruction set in its own translation unit (the AVX2 one is built with
+// -mavx2). Only intrinsics and constants are used here so no out-of-line
+// function compiled for AVX2 can leak into the baseline code.
+#include <cstddef>
+#include <cstdint>
+
+#include "model/fast_trig.h"
+
+namespace Model::SimdDetail {
+
+struct KernelArgs {
+    float* x;
+    float* y;
+    float* yaw;
+    float* v;
+    float* yaw_rate;
+    float* wheel_omega;
+    const float* drive;
+    const float* brake;
+    const float* steer;
+    const uint8_t* estop;
+    float dt, drag, estop_decel, vmax, r, L;
+};
+
+// Vehicles [begin, end) with the scalar fast-trig path (also the SIMD tails)
+void StepRangeScalar(const KernelArgs& a, std::size_t begin, std::size_t end);
+
+// Whole vectors only; return how many vehicles were processed
+std::size_t StepRangeSse2(const KernelArgs& a, std::size_t n);
+std::size_t StepRangeAvx2(const KernelArgs& a, std::size_t n);
+
+namespace {
+
+// Same expression order as StepBicycleBatch / FastTrig:: (see fast_trig.h)
+template <class V>
+inline std::size_t StepLanes(const KernelArgs& a, std::size_t n)
+{
+    using F = typename V::F;
+    using I = typename V::I;
+    namespace T = Model::FastTrig;
+
+    const F dt = V::Set1(a.dt);
+    const F drag = V::Set1(a.drag);
+    const F estop_decel = V::Set1(a.estop_decel);
+    const F vmax = V::Set1(a.vmax);
+    const F zero = V::Set1(0.0f);
+    const F r = V::Set1(a.r);
+    const F L = V::Set1(a.L);
+    const F one = V::Set1(1.0f);
+    const F neg_one = V::Set1(-1.0f);
+    const F half = V::Set1(0.5f);
+    const I i1 = V::Set1i(1);
+    const I i2 = V::Set1i(2);
+
+    auto reduce = [&](F x, I& q) {
+        const F qf = V::ToFloat(q = V::RoundToInt(V::Mul(x, V::Set1(T::kTwoOverPi))));
+        return V::Sub(V::Sub(V::Sub(x, V::Mul(qf, V::Set1(T::kPiO2_1))),
+                             V::Mul(qf, V::Set1(T::kPiO2_2))),
+                      V::Mul(qf, V::Set1(T::kPiO2_3)));
+    };
+    auto poly = [&](F z, float c3, float c2, float c1) {
+        return V::Add(V::Mul(V::Add(V::Mul(V::Set1(c3), z), V::Set1(c2)), z), V::Set1(c1));
+    };
+    // 1 << 31 in the lanes where (q & bit) != 0
+    auto sign_if = [&](I q, I bit) { return V::AsFloat(V::Shl30(V::And(q, bit))); };
+
+    std::size_t i = 0;
+    for (; i + V::kLanes <= n; i += V::kLanes) {
+        // Longitudinal
+        F v = V::Load(a.v + i);
+        F accel = V::Sub(V::Sub(V::Load(a.drive + i), V::Load(a.brake + i)), V::Mul(drag, v));
+        accel = V::Select(V::EstopMask(a.estop + i), V::Sub(accel, estop_decel), accel);
+        const F vn = V::Add(v, V::Mul(accel, dt));
+        v = V::Min(vmax, V::Max(zero, vn));
+        V::Store(a.v + i, v);
+        V::Store(a.wheel_omega + i, V::Div(v, r));
+
+        // tan(steer)
+        I qt;
+        const F rt = reduce(V::Load(a.steer + i), qt);
+        const F zt = V::Mul(rt, rt);
+        F tp = V::Add(V::Mul(V::Add(V::Mul(V::Add(V::Mul(poly(zt, T::kTan6, T::kTan5, T::kTan4), zt),
+                                                 V::Set1(T::kTan3)), zt), V::Set1(T::kTan2)), zt),
+                      V::Set1(T::kTan1));
+        tp = V::Add(V::Mul(V::Mul(tp, zt), rt), rt);
+        tp = V::Select(V::MaskEq(V::And(qt, i1), i1), V::Div(neg_one, tp), tp);
+
+        const F yr = V::Mul(V::Div(v, L), tp);
+        V::Store(a.yaw_rate + i, yr);
+        const F yaw = V::Add(V::Load(a.yaw + i), V::Mul(yr, dt));
+        V::Store(a.yaw + i, yaw);
+
+        // sin/cos(yaw)
+        I q;
+        const F rs = reduce(yaw, q);
+        const F z = V::Mul(rs, rs);
+        const F sp = V::Add(V::Mul(V::Mul(poly(z, T::kSin3, T::kSin2, T::kSin1), z), rs), rs);
+        const F cp = V::Add(V::Sub(V::Mul(V::Mul(poly(z, T::kCos3, T::kCos2, T::kCos1), z), z),
+                                   V::Mul(half, z)), one);
+        const F swap = V::MaskEq(V::And(q, i1), i1);
+        const F s = V::Xor(V::Select(swap, cp, sp), sign_if(q, i2));
+        const F c = V::Xor(V::Select(swap, sp, cp), sign_if(V::AddI(q, i1), i2));
+
+        V::Store(a.x + i, V::Add(V::Load(a.x + i), V::Mul(V::Mul(v, c), dt)));
+        V::Store(a.y + i, V::Add(V::Load(a.y + i), V::Mul(V::Mul(v, s), dt)));
+    }
+    return i;
+}
+
+} // namespace
+
+} // namespace Model::SimdDetail
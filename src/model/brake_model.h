@@ -1,6 +1,8 @@
 #pragma once
 #include <algorithm>
 
+#include "model/param_limits.h"
+
 namespace Model {
 
 /**
@@ -45,4 +47,32 @@ inline float ComputeBrakeDecel(float brake_0_1, bool estop, const BrakeParams& p
     return brake_clamped * p.max_decel_mps2;
 }
 
+/**
+ * @brief ComputeBrakeDecel with the parameter set fixed at compile time
+ *
+ * Same expression sequence as the runtime version (bit-identical results), but
+ * the parameters are constants the compiler can fold. P must be a constexpr
+ * object with static storage, e.g. Model::Fixed::kBrakeV1 (model/fixed_params.h);
+ * an implausible set fails to compile.
+ *
+ * @code
+ * float decel = ComputeBrakeDecel<Fixed::kBrakeV1>(0.5f, false);  // 2.0 m/s²
+ * @endcode
+ */
+template <const BrakeParams& P>
+constexpr float ComputeBrakeDecel(float brake_0_1, bool estop)
+{
+    static_assert(Limits::kMaxDecelMps2.Contains(P.max_decel_mps2),
+                  "BrakeParams::max_decel_mps2 must be in (0, 20] m/s^2");
+    static_assert(P.estop_max_decel_mps2 >= P.max_decel_mps2 &&
+                      Limits::kEstopMaxDecelMps2.Contains(P.estop_max_decel_mps2),
+                  "BrakeParams::estop_max_decel_mps2 must be in [max_decel_mps2, 20] m/s^2");
+
+    if (estop) {
+        return P.estop_max_decel_mps2;
+    }
+    float brake_clamped = std::clamp(brake_0_1, 0.0f, 1.0f);
+    return brake_clamped * P.max_decel_mps2;
+}
+
 } // namespace Model
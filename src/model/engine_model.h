@@ -1,6 +1,8 @@
 #pragma once
 #include <algorithm>
 
+#include "model/param_limits.h"
+
 namespace Model {
 
 struct EngineParams {
@@ -13,4 +15,16 @@ inline float ComputeDriveAccel(float throttle_0_1, bool estop, const EngineParam
   return th * p.max_accel_mps2;
 }
 
+// ComputeDriveAccel with the parameter set fixed at compile time (bit-identical
+// to the runtime version; see ComputeBrakeDecel<P> and model/fixed_params.h)
+template <const EngineParams& P>
+constexpr float ComputeDriveAccel(float throttle_0_1, bool estop) {
+  static_assert(Limits::kMaxAccelMps2.Contains(P.max_accel_mps2),
+                "EngineParams::max_accel_mps2 must be in (0, 20] m/s^2");
+
+  if (estop) return 0.0f;
+  float th = std::clamp(throttle_0_1, 0.0f, 1.0f);
+  return th * P.max_accel_mps2;
+}
+
 } // namespace Model
@@ -0,0 +1,86 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+
+// Polynomial sin/cos/tan in float (Cephes sinf/cosf/tanf coefficients, minimax
+// on [-pi/4, pi/4]) with Cody-Waite reduction by pi/2. Every operation is a
+// plain IEEE add/mul/div in a fixed order, so the SIMD kernels in
+// bicycle_simd.cpp reproduce these scalar results bit for bit.
+//
+// Error bounds (tested in test_fast_trig.cpp against double precision libm;
+// measured maxima in brackets):
+//  - SinCos: abs error <= 1.0e-7 for |x| <= 8192 rad   [7.8e-8]
+//  - Tan:    rel error <= 1.0e-7 for |x| <= 0.40 rad   [7.6e-8]
+//            (the steering range +-max_steer_angle_rad)
+//            rel error <= 2.0e-7 for |x| <= 1.0 rad    [1.7e-7]
+// Beyond |x| = 8192 the three-part reduction loses accuracy progressively.
+namespace Model::FastTrig {
+
+constexpr float kTwoOverPi = 0.636619772367581343f;
+// pi/2 split so q * kPiO2_1 and q * kPiO2_2 are exact for |q| < 2^13
+constexpr float kPiO2_1 = 1.5703125f;
+constexpr float kPiO2_2 = 4.837512969970703125e-4f;
+constexpr float kPiO2_3 = 7.54978995489188216e-8f;
+
+constexpr float kSin1 = -1.6666654611e-1f;
+constexpr float kSin2 = 8.3321608736e-3f;
+constexpr float kSin3 = -1.9515295891e-4f;
+
+constexpr float kCos1 = 4.166664568298827e-2f;
+constexpr float kCos2 = -1.388731625493765e-3f;
+constexpr float kCos3 = 2.443315711809948e-5f;
+
+constexpr float kTan1 = 3.33331568548e-1f;
+constexpr float kTan2 = 1.33387994085e-1f;
+constexpr float kTan3 = 5.34112807005e-2f;
+constexpr float kTan4 = 2.44301354525e-2f;
+constexpr float kTan5 = 3.11992232697e-3f;
+constexpr float kTan6 = 9.38540185543e-3f;
+
+// x = r + q * pi/2 with |r| <= pi/4 (q rounded to nearest, ties to even)
+inline float Reduce(float x, int32_t& q)
+{
+    const float qf = std::nearbyint(x * kTwoOverPi);
+    q = static_cast<int32_t>(qf);
+    return ((x - qf * kPiO2_1) - qf * kPiO2_2) - qf * kPiO2_3;
+}
+
+inline float SinPoly(float r)
+{
+    const float z = r * r;
+    return ((kSin3 * z + kSin2) * z + kSin1) * z * r + r;
+}
+
+inline float CosPoly(float r)
+{
+    const float z = r * r;
+    return ((kCos3 * z + kCos2) * z + kCos1) * z * z - 0.5f * z + 1.0f;
+}
+
+inline float TanPoly(float r)
+{
+    const float z = r * r;
+    return (((((kTan6 * z + kTan5) * z + kTan4) * z + kTan3) * z + kTan2) * z + kTan1) * z * r + r;
+}
+
+inline void SinCos(float x, float& s, float& c)
+{
+    int32_t q = 0;
+    const float r = Reduce(x, q);
+    const float sp = SinPoly(r);
+    const float cp = CosPoly(r);
+    const bool swap = (q & 1) != 0;
+    s = swap ? cp : sp;
+    c = swap ? sp : cp;
+    if ((q & 2) != 0) s = -s;
+    if (((q + 1) & 2) != 0) c = -c;
+}
+
+inline float Tan(float x)
+{
+    int32_t q = 0;
+    const float t = TanPoly(Reduce(x, q));
+    return (q & 1) != 0 ? -1.0f / t : t;
+}
+
+} // namespace Model::FastTrig
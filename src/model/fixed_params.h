@@ -0,0 +1,17 @@
+#pragma once
+
+#include "model/brake_model.h"
+#include "model/engine_model.h"
+#include "model/vehicledynamics_model.h"
+
+// Frozen parameter sets for the compile-time model variants
+// (ComputeBrakeDecel<P>, ComputeDriveAccel<P>, StepLongitudinal<P>).
+// A production build with a fixed calibration declares its own set the same
+// way; the variants static_assert that every field is in range.
+namespace Model::Fixed {
+
+inline constexpr BrakeParams kBrakeV1{};
+inline constexpr EngineParams kEngineV1{};
+inline constexpr VehicleParams kVehicleV1{};
+
+} // namespace Model::Fixed
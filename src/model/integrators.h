@@ -0,0 +1,162 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace Model {
+
+enum class Integrator : uint8_t {
+    SemiImplicitEuler = 0, // v first, then yaw/position with the new v (v1 plant)
+    Rk4 = 1,               // classic 4th order Runge-Kutta, fixed sub-steps
+    Rk45 = 2               // Dormand-Prince 5(4), adaptive step with error control
+};
+
+/**
+ * @brief Plant integration settings, independent of the SWC rate
+ *
+ * Each plant call of length dt is split into `substeps` equal steps
+ * (SemiImplicitEuler, Rk4). Rk45 starts from dt / substeps and adapts the
+ * step so the local error stays within atol + rtol * |state|.
+ */
+struct IntegratorConfig {
+    Integrator method = Integrator::SemiImplicitEuler;
+    int substeps = 1;
+    double rtol = 1e-6;
+    double atol = 1e-6;
+    int max_steps = 10000; // Rk45: cap on attempted steps per call
+};
+
+inline const char* IntegratorName(Integrator m)
+{
+    switch (m) {
+    case Integrator::Rk4: return "rk4";
+    case Integrator::Rk45: return "rk45";
+    case Integrator::SemiImplicitEuler: break;
+    }
+    return "euler";
+}
+
+// "euler" | "rk4" | "rk45"
+inline bool ParseIntegrator(const char* name, Integrator& out)
+{
+    for (const auto m : {Integrator::SemiImplicitEuler, Integrator::Rk4, Integrator::Rk45}) {
+        if (std::strcmp(name, IntegratorName(m)) == 0) {
+            out = m;
+            return true;
+        }
+    }
+    return false;
+}
+
+namespace Ode {
+
+template <std::size_t N>
+using State = std::array<double, N>;
+
+template <std::size_t N>
+inline State<N> Axpy(const State<N>& y, double h, const State<N>& k)
+{
+    State<N> out;
+    for (std::size_t i = 0; i < N; ++i) out[i] = y[i] + h * k[i];
+    return out;
+}
+
+// One classic RK4 step; project() enforces state constraints after the step
+template <std::size_t N, typename Rhs>
+inline void Rk4Step(State<N>& y, double h, Rhs&& f)
+{
+    const State<N> k1 = f(y);
+    const State<N> k2 = f(Axpy(y, 0.5 * h, k1));
+    const State<N> k3 = f(Axpy(y, 0.5 * h, k2));
+    const State<N> k4 = f(Axpy(y, h, k3));
+    for (std::size_t i = 0; i < N; ++i) {
+        y[i] += h / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    }
+}
+
+template <std::size_t N, typename Rhs, typename Project>
+inline void IntegrateRk4(State<N>& y, double dt, int substeps, Rhs&& f, Project&& project)
+{
+    const int n = std::max(substeps, 1);
+    const double h = dt / n;
+    for (int i = 0; i < n; ++i) {
+        Rk4Step(y, h, f);
+        project(y);
+    }
+}
+
+/**
+ * @brief Adaptive Dormand-Prince 5(4) over [0, dt]
+ *
+ * @return number of accepted steps. Attempt max_steps is forced to span the
+ * rest of the interval and accepted, so a call never exceeds max_steps attempts.
+ */
+template <std::size_t N, typename Rhs, typename Project>
+inline int IntegrateRk45(State<N>& y, double dt, const IntegratorConfig& cfg, Rhs&& f, Project&& project)
+{
+    constexpr double a21 = 1.0 / 5;
+    constexpr double a31 = 3.0 / 40, a32 = 9.0 / 40;
+    constexpr double a41 = 44.0 / 45, a42 = -56.0 / 15, a43 = 32.0 / 9;
+    constexpr double a51 = 19372.0 / 6561, a52 = -25360.0 / 2187, a53 = 64448.0 / 6561, a54 = -212.0 / 729;
+    constexpr double a61 = 9017.0 / 3168, a62 = -355.0 / 33, a63 = 46732.0 / 5247, a64 = 49.0 / 176,
+                     a65 = -5103.0 / 18656;
+    constexpr double b1 = 35.0 / 384, b3 = 500.0 / 1113, b4 = 125.0 / 192, b5 = -2187.0 / 6784, b6 = 11.0 / 84;
+    // b - b* (5th minus embedded 4th order weights)
+    constexpr double e1 = 71.0 / 57600, e3 = -71.0 / 16695, e4 = 71.0 / 1920, e5 = -17253.0 / 339200,
+                     e6 = 22.0 / 525, e7 = -1.0 / 40;
+
+    double t = 0.0;
+    double h = dt / std::max(cfg.substeps, 1);
+    int accepted = 0;
+    for (int attempt = 0; t < dt; ++attempt) {
+        const bool last_chance = attempt + 1 >= cfg.max_steps;
+        const bool final_step = last_chance || h >= dt - t;
+        if (final_step) h = dt - t;
+
+        const State<N> k1 = f(y);
+        State<N> s;
+        for (std::size_t i = 0; i < N; ++i) s[i] = y[i] + h * a21 * k1[i];
+        const State<N> k2 = f(s);
+        for (std::size_t i = 0; i < N; ++i) s[i] = y[i] + h * (a31 * k1[i] + a32 * k2[i]);
+        const State<N> k3 = f(s);
+        for (std::size_t i = 0; i < N; ++i) s[i] = y[i] + h * (a41 * k1[i] + a42 * k2[i] + a43 * k3[i]);
+        const State<N> k4 = f(s);
+        for (std::size_t i = 0; i < N; ++i) {
+            s[i] = y[i] + h * (a51 * k1[i] + a52 * k2[i] + a53 * k3[i] + a54 * k4[i]);
+        }
+        const State<N> k5 = f(s);
+        for (std::size_t i = 0; i < N; ++i) {
+            s[i] = y[i] + h * (a61 * k1[i] + a62 * k2[i] + a63 * k3[i] + a64 * k4[i] + a65 * k5[i]);
+        }
+        const State<N> k6 = f(s);
+        State<N> y5;
+        for (std::size_t i = 0; i < N; ++i) {
+            y5[i] = y[i] + h * (b1 * k1[i] + b3 * k3[i] + b4 * k4[i] + b5 * k5[i] + b6 * k6[i]);
+        }
+        const State<N> k7 = f(y5);
+
+        double err = 0.0;
+        for (std::size_t i = 0; i < N; ++i) {
+            const double e = h * (e1 * k1[i] + e3 * k3[i] + e4 * k4[i] + e5 * k5[i] + e6 * k6[i] + e7 * k7[i]);
+            const double scale = cfg.atol + cfg.rtol * std::max(std::fabs(y[i]), std::fabs(y5[i]));
+            err = std::max(err, std::fabs(e) / scale);
+        }
+
+        if (err <= 1.0 || last_chance) {
+            t = final_step ? dt : t + h;
+            y = y5;
+            project(y);
+            ++accepted;
+        }
+        // Standard controller: safety 0.9, growth limited to [0.2, 5]
+        const double factor = err == 0.0 ? 5.0 : std::clamp(0.9 * std::pow(err, -0.2), 0.2, 5.0);
+        h *= factor;
+    }
+    return accepted;
+}
+
+} // namespace Ode
+
+} // namespace Model
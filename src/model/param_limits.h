@@ -0,0 +1,29 @@
+#pragma once
+
+// Plausible range of every calibratable model parameter. The compile-time
+// model variants (ComputeBrakeDecel<P>, ComputeDriveAccel<P>, StepLongitudinal<P>)
+// static_assert their fields against it, and a calibration file with a value
+// outside it is rejected before it reaches the ECU (bsw/calib_store.h).
+namespace Model::Limits {
+
+struct Range {
+    float lo;
+    float hi;
+    bool lo_open = false; // (lo, hi] instead of [lo, hi]
+
+    // False for NaN
+    constexpr bool Contains(float v) const { return (lo_open ? v > lo : v >= lo) && v <= hi; }
+};
+
+inline constexpr Range kMaxAccelMps2{0.0f, 20.0f, true};
+inline constexpr Range kMaxDecelMps2{0.0f, 20.0f, true};
+inline constexpr Range kEstopMaxDecelMps2{0.0f, 20.0f, true};
+inline constexpr Range kMaxSteerAngleRad{0.0f, 1.5f};  // below pi/2: the bicycle model takes tan()
+inline constexpr Range kSteerTauS{1e-3f, 10.0f};
+inline constexpr Range kWheelRadiusM{1e-4f, 1.0f};
+inline constexpr Range kWheelbaseM{1e-3f, 10.0f};
+inline constexpr Range kLinearDrag{0.0f, 10.0f};
+inline constexpr Range kMaxSpeedMps{0.0f, 100.0f, true}; // upper bound of a clamp: must stay above 0
+inline constexpr Range kEstopDecelMps2{0.0f, 20.0f};
+
+} // namespace Model::Limits
@@ -0,0 +1,41 @@
+#pragma once
+#include <algorithm>
+
+namespace Model {
+
+/**
+ * @brief Steering actuator parameters (SteeringSWC)
+ */
+struct SteeringParams {
+    float max_steer_angle_rad = 0.40f; ///< ~23 deg
+    float steer_tau_s = 0.15f;         ///< first-order lag
+};
+
+/**
+ * @brief Target steer angle from the normalized steering input (-1..1)
+ *
+ * @note Returns 0 rad (straight ahead) while estop is active
+ */
+inline float ComputeSteerTarget(float steer_m1_1, bool estop, const SteeringParams& p)
+{
+    if (estop) {
+        return 0.0f;
+    }
+    const float steer = std::clamp(steer_m1_1, -1.0f, 1.0f);
+    return steer * p.max_steer_angle_rad;
+}
+
+/**
+ * @brief One explicit-Euler step of the first-order lag d/dt x = (target - x) / tau
+ *
+ * @param angle Lag state (rad), updated in place
+ * @return Steering command, clamped to +-max_steer_angle_rad
+ */
+inline float StepSteerLag(float& angle, float target, double dt_s, const SteeringParams& p)
+{
+    const float tau = std::max(p.steer_tau_s, 1e-3f);
+    angle += static_cast<float>((target - angle) * (dt_s / tau));
+    return std::clamp(angle, -p.max_steer_angle_rad, p.max_steer_angle_rad);
+}
+
+} // namespace Model
@@ -2,6 +2,9 @@
 #include <algorithm>
 #include <cmath>
 
+#include "model/integrators.h"
+#include "model/param_limits.h"
+
 namespace Model {
 
 struct VehicleParams {
@@ -43,4 +46,90 @@ inline VehicleState StepLongitudinal(
   return out;
 }
 
+// StepLongitudinal with the parameter set fixed at compile time (bit-identical
+// to the runtime version; see ComputeBrakeDecel<P> and model/fixed_params.h).
+// The wheel radius guard and the clamp bound fold into constants; the division
+// stays a division so results do not change.
+template <const VehicleParams& P>
+constexpr VehicleState StepLongitudinal(
+    const VehicleState& s,
+    float dt,
+    float drive_accel_cmd,
+    float brake_decel_cmd,
+    bool estop)
+{
+  static_assert(Limits::kWheelRadiusM.Contains(P.wheel_radius_m),
+                "VehicleParams::wheel_radius_m must be in [1e-4, 1] m");
+  static_assert(Limits::kLinearDrag.Contains(P.linear_drag),
+                "VehicleParams::linear_drag must be in [0, 10] 1/s");
+  static_assert(Limits::kMaxSpeedMps.Contains(P.max_speed_mps),
+                "VehicleParams::max_speed_mps must be in (0, 100] m/s");
+  static_assert(Limits::kEstopDecelMps2.Contains(P.estop_decel_mps2),
+                "VehicleParams::estop_decel_mps2 must be in [0, 20] m/s^2");
+
+  VehicleState out = s;
+
+  float accel = drive_accel_cmd - brake_decel_cmd - P.linear_drag * out.v;
+  if (estop) accel -= P.estop_decel_mps2;
+
+  out.v = std::clamp(out.v + accel * dt, 0.0f, P.max_speed_mps);
+
+  constexpr float r = std::max(P.wheel_radius_m, 1e-4f);
+  out.wheel_omega = out.v / r;
+
+  out.t += dt;
+  return out;
+}
+
+// StepLongitudinal with a selectable integrator; SemiImplicitEuler with one
+// sub-step is exactly the function above (for a single state both Euler
+// variants coincide).
+inline VehicleState StepLongitudinal(
+    const VehicleState& s,
+    float dt,
+    float drive_accel_cmd,
+    float brake_decel_cmd,
+    bool estop,
+    const VehicleParams& p,
+    const IntegratorConfig& cfg)
+{
+  const int n = std::max(cfg.substeps, 1);
+  if (cfg.method == Integrator::SemiImplicitEuler && n == 1) {
+    return StepLongitudinal(s, dt, drive_accel_cmd, brake_decel_cmd, estop, p);
+  }
+
+  VehicleState out = s;
+  if (cfg.method == Integrator::SemiImplicitEuler) {
+    const float h = dt / static_cast<float>(n);
+    for (int i = 0; i < n; ++i) {
+      out = StepLongitudinal(out, h, drive_accel_cmd, brake_decel_cmd, estop, p);
+    }
+    out.t = s.t + dt;
+    return out;
+  }
+
+  const double vmax = p.max_speed_mps;
+  const double a_cmd = static_cast<double>(drive_accel_cmd) - brake_decel_cmd -
+                       (estop ? static_cast<double>(p.estop_decel_mps2) : 0.0);
+  const double drag = p.linear_drag;
+  auto rhs = [&](const Ode::State<1>& y) {
+    const double v = std::clamp(y[0], 0.0, vmax);
+    double dv = a_cmd - drag * v;
+    if ((v <= 0.0 && dv < 0.0) || (v >= vmax && dv > 0.0)) dv = 0.0;
+    return Ode::State<1>{dv};
+  };
+  auto project = [&](Ode::State<1>& y) { y[0] = std::clamp(y[0], 0.0, vmax); };
+
+  Ode::State<1> y{out.v};
+  if (cfg.method == Integrator::Rk4) {
+    Ode::IntegrateRk4(y, dt, n, rhs, project);
+  } else {
+    Ode::IntegrateRk45(y, dt, cfg, rhs, project);
+  }
+  out.v = static_cast<float>(y[0]);
+  out.wheel_omega = out.v / std::max(p.wheel_radius_m, 1e-4f);
+  out.t = s.t + dt;
+  return out;
+}
+
 } // namespace Model
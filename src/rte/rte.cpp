@@ -1,32 +1,59 @@
 #include "rte/rte.h"
 
 namespace {
-    Rte::DriverInput g_driver_input{};
-    Rte::ActuatorCmd g_actuator_cmd{};
-    Rte::VehicleState g_vehicle_state{};
-    Rte::Safety g_safety{};
+    Rte::Context g_default_ctx{};
 }
 
 namespace Rte {
 
-void InitDefaults()
+Context& DefaultContext() { return g_default_ctx; }
+
+void InitDefaults(Context& ctx)
+{
+    const Calibration calib = ctx.calib;
+    const uint32_t calib_seq = ctx.calib_seq;
+    ctx = Context{};
+    ctx.calib = calib;
+    ctx.calib_seq = calib_seq;
+}
+
+DriverInput Rte_Read_DriverInput(const Context& ctx) { return ctx.driver_input.Read(); }
+void Rte_Write_DriverInput(Context& ctx, const DriverInput& v) { ctx.driver_input.Write(v); }
+
+ActuatorCmd Rte_Read_ActuatorCmd(const Context& ctx)
 {
-    g_driver_input = DriverInput{};
-    g_actuator_cmd = ActuatorCmd{};
-    g_vehicle_state = VehicleState{};
-    g_safety = Safety{};
+    ActuatorCmd v;
+    v.drive_accel_cmd = ctx.actuator_cmd.drive_accel_cmd.Read();
+    v.brake_decel_cmd = ctx.actuator_cmd.brake_decel_cmd.Read();
+    v.steer_angle_cmd = ctx.actuator_cmd.steer_angle_cmd.Read();
+    return v;
 }
 
-DriverInput Rte_Read_DriverInput() { return g_driver_input; }
-void Rte_Write_DriverInput(const DriverInput& v) { g_driver_input = v; }
+void Rte_Write_ActuatorCmd(Context& ctx, const ActuatorCmd& v)
+{
+    Rte_Write_ActuatorCmd_DriveAccelCmd(ctx, v.drive_accel_cmd);
+    Rte_Write_ActuatorCmd_BrakeDecelCmd(ctx, v.brake_decel_cmd);
+    Rte_Write_ActuatorCmd_SteerAngleCmd(ctx, v.steer_angle_cmd);
+}
+
+VehicleState Rte_Read_VehicleState(const Context& ctx) { return ctx.vehicle_state.Read(); }
+void Rte_Write_VehicleState(Context& ctx, const VehicleState& v) { ctx.vehicle_state.Write(v); }
+
+Safety Rte_Read_Safety(const Context& ctx) { return ctx.safety.Read(); }
+void Rte_Write_Safety(Context& ctx, const Safety& v) { ctx.safety.Write(v); }
+
+void InitDefaults() { InitDefaults(g_default_ctx); }
+
+DriverInput Rte_Read_DriverInput() { return Rte_Read_DriverInput(g_default_ctx); }
+void Rte_Write_DriverInput(const DriverInput& v) { Rte_Write_DriverInput(g_default_ctx, v); }
 
-ActuatorCmd Rte_Read_ActuatorCmd() { return g_actuator_cmd; }
-void Rte_Write_ActuatorCmd(const ActuatorCmd& v) { g_actuator_cmd = v; }
+ActuatorCmd Rte_Read_ActuatorCmd() { return Rte_Read_ActuatorCmd(g_default_ctx); }
+void Rte_Write_ActuatorCmd(const ActuatorCmd& v) { Rte_Write_ActuatorCmd(g_default_ctx, v); }
 
-VehicleState Rte_Read_VehicleState() { return g_vehicle_state; }
-void Rte_Write_VehicleState(const VehicleState& v) { g_vehicle_state = v; }
+VehicleState Rte_Read_VehicleState() { return Rte_Read_VehicleState(g_default_ctx); }
+void Rte_Write_VehicleState(const VehicleState& v) { Rte_Write_VehicleState(g_default_ctx, v); }
 
-Safety Rte_Read_Safety() { return g_safety; }
-void Rte_Write_Safety(const Safety& v) { g_safety = v; }
+Safety Rte_Read_Safety() { return Rte_Read_Safety(g_default_ctx); }
+void Rte_Write_Safety(const Safety& v) { Rte_Write_Safety(g_default_ctx, v); }
 
 } // namespace Rte
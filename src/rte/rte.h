@@ -1,6 +1,17 @@
 #pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 
+#include "model/bicycle_model.h"
+#include "model/brake_model.h"
+#include "model/engine_model.h"
+#include "model/steering_model.h"
+#include "rte/rte_port.h"
+
+namespace Swc::DriverInput { class InputSource; }
+
 namespace Rte {
 
 enum class SystemState : uint8_t {
@@ -36,9 +47,172 @@ struct Safety {
     SystemState system_state = SystemState::Normal;
 };
 
+// Per-instance memory (AUTOSAR PIM): SWC-internal state kept by the RTE instance
+// Replaces the built-in demo scenario when set (not owned, see Swc::DriverInput::SetSource)
+struct DriverInputPim {
+    Swc::DriverInput::InputSource* source = nullptr;
+};
+
+struct SteeringPim {
+    float steer_angle = 0.0f; // rad, first-order lag state
+};
+
+// Runnables under Diag alive/deadline supervision (index into DiagPim / Calibration::supervision)
+enum class SupervisedEntity : uint8_t {
+    DriverInput = 0,
+    Engine = 1,
+    Brake = 2,
+    Steering = 3,
+    VehicleDynamics = 4
+};
+constexpr std::size_t kSupervisedEntities = 5;
+
+enum class SupervisionStatus : uint8_t {
+    Ok = 0,
+    Failed = 1, // missed deadlines in the last cycle, within failed_cycles_tolerance
+    Expired = 2 // too many consecutive failed cycles; latched until Diag::Init
+};
+
+// Alive counter of one runnable, bumped from whichever thread runs it.
+// One cache line each so runnables executing in parallel do not contend.
+struct alignas(kCacheLineSize) AliveCounter {
+    std::atomic<uint32_t> count{0};
+
+    AliveCounter() = default;
+    AliveCounter(const AliveCounter& o) noexcept : count(o.count.load(std::memory_order_relaxed)) {}
+    AliveCounter& operator=(const AliveCounter& o) noexcept
+    {
+        count.store(o.count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+};
+
+// Supervisor-side bookkeeping per entity (touched by the 100ms supervision only)
+struct DeadlineMonitor {
+    bool started = false;         // supervision starts with the first alive indication
+    uint32_t seen = 0;            // alive count at the last check
+    int64_t deadline_ms = 0;      // next indication due, supervision time
+    uint32_t failed_cycles = 0;   // consecutive cycles with missed deadlines
+    uint64_t missed_total = 0;
+    SupervisionStatus status = SupervisionStatus::Ok;
+};
+
+struct DiagPim {
+    uint64_t heartbeat = 0;
+    std::array<AliveCounter, kSupervisedEntities> alive{};
+    std::array<DeadlineMonitor, kSupervisedEntities> monitor{};
+    int64_t supervision_ms = -1; // time of the last supervision cycle, -1 before the first
+};
+
+// Expected alive rate of one supervised runnable
+struct AliveSupervisionConfig {
+    uint16_t period_ms = 10;
+    uint16_t tolerance_ms = 10;          // lateness absorbed before a deadline counts as missed
+    uint8_t failed_cycles_tolerance = 2; // consecutive failed cycles before Expired
+    bool enabled = true;
+};
+
+using SupervisionConfig = std::array<AliveSupervisionConfig, kSupervisedEntities>;
+
+// Rates of the ECU task table (app/ecu.h): DriverInput 20ms, the rest 10ms
+inline SupervisionConfig DefaultSupervisionConfig()
+{
+    SupervisionConfig c{};
+    c[static_cast<std::size_t>(SupervisedEntity::DriverInput)].period_ms = 20;
+    c[static_cast<std::size_t>(SupervisedEntity::DriverInput)].tolerance_ms = 20;
+    return c;
+}
+
+// Calibration parameters (AUTOSAR Rte_Prm), one set per ECU instance
+struct Calibration {
+    Model::EngineParams engine{};
+    Model::BrakeParams brake{};
+    Model::SteeringParams steering{};
+    Model::BicycleParams vehicle{};
+    Model::IntegratorConfig plant_integrator{}; // VehicleDynamics plant, decoupled from the 10ms rate
+    SupervisionConfig supervision = DefaultSupervisionConfig();
+};
+
+// ActuatorCmd is stored per element: each element has its own writer SWC.
+// A seqlock admits one writer, so the three elements cannot share one.
+struct ActuatorCmdPorts {
+    Port<float> drive_accel_cmd;
+    Port<float> brake_decel_cmd;
+    Port<float> steer_angle_cmd;
+};
+
+// One ECU instance: all port buffers + SWC/BSW internal state + calibration.
+// Runnables only touch the Context they are given, so independent
+// Contexts can be simulated side by side on different threads.
+// Ports are accessed through Rte_Read_* / Rte_Write_* only (see rte_port.h).
+struct Context {
+    Port<DriverInput> driver_input;
+    ActuatorCmdPorts actuator_cmd;
+    Port<VehicleState> vehicle_state;
+    Port<Safety> safety;
+
+    DriverInputPim driver{}; // DriverInput SWC (the port of the same name is driver_input)
+    SteeringPim steering{};
+    DiagPim diag{};
+
+    Calibration calib{};
+    uint32_t calib_seq = 0; // bumped whenever calib is replaced at runtime (Bsw::Calib::Store::Apply)
+};
+
+// Instance used by the context-free API below
+Context& DefaultContext();
+
+// Resets port buffers and per-instance memory; calibration is kept.
+void InitDefaults(Context& ctx);
+
+// Read / Write APIs (AUTOSAR-like style), explicit instance
+DriverInput Rte_Read_DriverInput(const Context& ctx);
+void Rte_Write_DriverInput(Context& ctx, const DriverInput& v);
+
+// Reads element by element: with SeqlockPort each element is a consistent value,
+// but while Engine/Brake/Steering run on other threads the three may come from
+// different cycles. Read it where the writers have finished (VehicleDynamics
+// joins on all three in the task graph).
+ActuatorCmd Rte_Read_ActuatorCmd(const Context& ctx);
+void Rte_Write_ActuatorCmd(Context& ctx, const ActuatorCmd& v);
+
+VehicleState Rte_Read_VehicleState(const Context& ctx);
+void Rte_Write_VehicleState(Context& ctx, const VehicleState& v);
+
+Safety Rte_Read_Safety(const Context& ctx);
+void Rte_Write_Safety(Context& ctx, const Safety& v);
+
+// Element-level ports of ActuatorCmd: exactly one writer SWC per element
+// (Engine -> drive_accel_cmd, Brake -> brake_decel_cmd, Steering -> steer_angle_cmd),
+// so the three 10ms actuator runnables do not depend on each other.
+inline void Rte_Write_ActuatorCmd_DriveAccelCmd(Context& ctx, float v) { ctx.actuator_cmd.drive_accel_cmd.Write(v); }
+inline void Rte_Write_ActuatorCmd_BrakeDecelCmd(Context& ctx, float v) { ctx.actuator_cmd.brake_decel_cmd.Write(v); }
+inline void Rte_Write_ActuatorCmd_SteerAngleCmd(Context& ctx, float v) { ctx.actuator_cmd.steer_angle_cmd.Write(v); }
+
+// Update sequence numbers (AUTOSAR DataReceivedEvent): a value changes whenever
+// the signal was written since it was last looked at. A runnable whose declared
+// inputs all kept their sequence number would compute the same outputs again.
+inline uint32_t Rte_Seq_DriverInput(const Context& ctx) { return ctx.driver_input.Seq(); }
+inline uint32_t Rte_Seq_ActuatorCmd(const Context& ctx)
+{
+    return ctx.actuator_cmd.drive_accel_cmd.Seq() + ctx.actuator_cmd.brake_decel_cmd.Seq() +
+           ctx.actuator_cmd.steer_angle_cmd.Seq();
+}
+inline uint32_t Rte_Seq_Safety(const Context& ctx) { return ctx.safety.Seq(); }
+inline uint32_t Rte_Seq_VehicleState(const Context& ctx) { return ctx.vehicle_state.Seq(); }
+inline uint32_t Rte_Seq_Calibration(const Context& ctx) { return ctx.calib_seq; }
+
+// Calibration access (read-only for runnables)
+inline const Model::EngineParams& Rte_Prm_Engine(const Context& ctx) { return ctx.calib.engine; }
+inline const Model::BrakeParams& Rte_Prm_Brake(const Context& ctx) { return ctx.calib.brake; }
+inline const Model::SteeringParams& Rte_Prm_Steering(const Context& ctx) { return ctx.calib.steering; }
+inline const Model::BicycleParams& Rte_Prm_VehicleDynamics(const Context& ctx) { return ctx.calib.vehicle; }
+inline const Model::IntegratorConfig& Rte_Prm_PlantIntegrator(const Context& ctx) { return ctx.calib.plant_integrator; }
+inline const SupervisionConfig& Rte_Prm_Supervision(const Context& ctx) { return ctx.calib.supervision; }
+
+// Default-instance facade
 void InitDefaults();
 
-// Read / Write APIs (AUTOSAR-like style)
 DriverInput Rte_Read_DriverInput();
 void Rte_Write_DriverInput(const DriverInput& v);
 
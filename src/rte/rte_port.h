@@ -0,0 +1,129 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Port storage backend of Rte::Context (CMake option SDV_RTE_SEQLOCK_PORTS).
+//  0: PlainPort   - plain copy, single-threaded use only (v1 behaviour)
+//  1: SeqlockPort - wait-free writer, consistent snapshot reads of one port from any thread
+// Both count updates: Seq() changes with every Write() (including assignment
+// from another port), which drives data-received triggering (see Rte_Seq_*).
+#ifndef SDV_RTE_SEQLOCK_PORTS
+#define SDV_RTE_SEQLOCK_PORTS 0
+#endif
+
+namespace Rte {
+
+constexpr std::size_t kCacheLineSize = 64;
+
+template <typename T>
+class PlainPort {
+public:
+    PlainPort() = default;
+    PlainPort(const PlainPort& o) : value_(o.value_) {}
+    PlainPort& operator=(const PlainPort& o)
+    {
+        Write(o.value_);
+        return *this;
+    }
+
+    T Read() const { return value_; }
+    void Write(const T& v)
+    {
+        value_ = v;
+        ++seq_;
+    }
+    uint32_t Seq() const { return seq_; }
+
+private:
+    T value_{};
+    uint32_t seq_ = 0;
+};
+
+/**
+ * @brief Single-writer / multi-reader sequence-lock port
+ *
+ * Write() never waits: it makes the sequence odd, stores the payload and
+ * makes it even again. Read() copies the payload and retries if the
+ * sequence was odd or changed meanwhile, so it always returns a snapshot of
+ * one complete Write(). The payload is kept in relaxed atomic words, which
+ * keeps the concurrent copy free of data races under the C++ memory model.
+ *
+ * Each port is aligned (and therefore padded) to a cache line so writers
+ * of different ports never false-share.
+ *
+ * @note Only one thread may call Write() for a given port at a time
+ *       (the RTE's single-writer-per-element rule).
+ */
+template <typename T>
+class alignas(kCacheLineSize) SeqlockPort {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqlockPort payload must be trivially copyable");
+
+public:
+    SeqlockPort() noexcept { Write(T{}); }
+
+    // Copies are snapshots (used to reset/copy a whole Context, not concurrently)
+    SeqlockPort(const SeqlockPort& o) noexcept { Write(o.Read()); }
+    SeqlockPort& operator=(const SeqlockPort& o) noexcept
+    {
+        Write(o.Read());
+        return *this;
+    }
+
+    void Write(const T& v) noexcept
+    {
+        uint64_t buf[kWords] = {};
+        std::memcpy(buf, &v, sizeof(T));
+
+        const uint32_t s = seq_.load(std::memory_order_relaxed);
+        seq_.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < kWords; ++i) {
+            words_[i].store(buf[i], std::memory_order_relaxed);
+        }
+        seq_.store(s + 2, std::memory_order_release);
+    }
+
+    T Read() const noexcept
+    {
+        uint64_t buf[kWords];
+        uint32_t s1 = 0;
+        uint32_t s2 = 0;
+        do {
+            s1 = seq_.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < kWords; ++i) {
+                buf[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            s2 = seq_.load(std::memory_order_relaxed);
+        } while ((s1 & 1u) != 0 || s1 != s2);
+
+        T v;
+        std::memcpy(&v, buf, sizeof(T));
+        return v;
+    }
+
+    // Number of completed writes (a write in progress is not counted yet)
+    uint32_t Seq() const noexcept { return seq_.load(std::memory_order_acquire) >> 1; }
+
+private:
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint32_t> seq_{0};
+    std::array<std::atomic<uint64_t>, kWords> words_{};
+};
+
+#if SDV_RTE_SEQLOCK_PORTS
+template <typename T>
+using Port = SeqlockPort<T>;
+constexpr bool kThreadSafePorts = true;
+#else
+template <typename T>
+using Port = PlainPort<T>;
+constexpr bool kThreadSafePorts = false;
+#endif
+
+} // namespace Rte
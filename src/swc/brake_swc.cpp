@@ -1,25 +1,26 @@
 #include "swc/brake_swc.h"
 #include "rte/rte.h"
+#include "bsw/diag.h"
 #include "model/brake_model.h"
 
 namespace Swc::Brake {
 
-static Model::BrakeParams g_params{};
-
-void Init() {}
+void Init(Rte::Context& /*ctx*/) {}
+void Init() { Init(Rte::DefaultContext()); }
 const char* Version() { return "BrakeSWC-v0.0.1"; }
 
-void Main10ms(double /*dt_s*/)
+void Main10ms(Rte::Context& ctx, double /*dt_s*/)
 {
-    const auto in = Rte::Rte_Read_DriverInput();
-    const auto sf = Rte::Rte_Read_Safety();
-
-    auto cmd = Rte::Rte_Read_ActuatorCmd();
+    const auto in = Rte::Rte_Read_DriverInput(ctx);
+    const auto sf = Rte::Rte_Read_Safety(ctx);
+    const auto& p = Rte::Rte_Prm_Brake(ctx);
 
     bool estop = sf.estop || sf.system_state == Rte::SystemState::EStop;
-    cmd.brake_decel_cmd = Model::ComputeBrakeDecel(in.brake, estop, g_params);
+    Rte::Rte_Write_ActuatorCmd_BrakeDecelCmd(ctx, Model::ComputeBrakeDecel(in.brake, estop, p));
 
-    Rte::Rte_Write_ActuatorCmd(cmd);
+    Bsw::Diag::ReportAlive(ctx, Rte::SupervisedEntity::Brake);
 }
 
+void Main10ms(double dt_s) { Main10ms(Rte::DefaultContext(), dt_s); }
+
 } // namespace Swc::Brake
@@ -1,5 +1,6 @@
 #include "swc/driverinput_swc.h"
 #include "rte/rte.h"
+#include "bsw/diag.h"
 #include <algorithm>
 #include <cmath>
 
@@ -7,24 +8,19 @@ namespace Swc::DriverInput {
 
 static float clampf(float v, float lo, float hi) { return std::max(lo, std::min(v, hi)); }
 
-void Init() {}
-
-void Main20ms(double /*dt_s*/)
+// v1 demo: built-in scenario (no external UI yet)
+// 0-2s: accelerate, 2-5s: cruise, 5-7s: brake, 7-10s: stop
+static void BuiltInScenario(float t, Rte::DriverInput& in)
 {
-    // v1 demo: built-in scenario (no external UI yet)
-    // 0-2s: accelerate, 2-5s: cruise, 5-7s: brake, 7-10s: stop
-    auto st = Rte::Rte_Read_VehicleState();
-    Rte::DriverInput in = Rte::Rte_Read_DriverInput();
-
-    if (st.t < 2.0f) {
+    if (t < 2.0f) {
         in.throttle = 0.6f;
         in.brake = 0.0f;
         in.steer = 0.0f;
-    } else if (st.t < 5.0f) {
+    } else if (t < 5.0f) {
         in.throttle = 0.2f;
         in.brake = 0.0f;
         in.steer = 0.2f; // slight turn in demo
-    } else if (st.t < 7.0f) {
+    } else if (t < 7.0f) {
         in.throttle = 0.0f;
         in.brake = 0.6f;
         in.steer = 0.0f;
@@ -33,12 +29,37 @@ void Main20ms(double /*dt_s*/)
         in.brake = 0.0f;
         in.steer = 0.0f;
     }
+}
+
+void Init(Rte::Context& /*ctx*/) {}
+void Init() { Init(Rte::DefaultContext()); }
+
+void SetSource(Rte::Context& ctx, InputSource* source) { ctx.driver.source = source; }
+void SetSource(InputSource* source) { SetSource(Rte::DefaultContext(), source); }
+
+void Main20ms(Rte::Context& ctx, double /*dt_s*/)
+{
+    auto st = Rte::Rte_Read_VehicleState(ctx);
+    Rte::DriverInput in = Rte::Rte_Read_DriverInput(ctx);
+
+    if (!ctx.driver.source) {
+        BuiltInScenario(st.t, in);
+    } else if (!ctx.driver.source->Sample(st.t, in)) {
+        // Source exhausted: release pedals and steering
+        in.throttle = 0.0f;
+        in.brake = 0.0f;
+        in.steer = 0.0f;
+    }
 
     in.throttle = clampf(in.throttle, 0.0f, 1.0f);
     in.brake    = clampf(in.brake,    0.0f, 1.0f);
     in.steer    = clampf(in.steer,   -1.0f, 1.0f);
 
-    Rte::Rte_Write_DriverInput(in);
+    Rte::Rte_Write_DriverInput(ctx, in);
+
+    Bsw::Diag::ReportAlive(ctx, Rte::SupervisedEntity::DriverInput);
 }
 
+void Main20ms(double dt_s) { Main20ms(Rte::DefaultContext(), dt_s); }
+
 } // namespace Swc::DriverInput
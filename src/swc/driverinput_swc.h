@@ -1,5 +1,29 @@
 #pragma once
+namespace Rte { struct Context; struct DriverInput; }
+
 namespace Swc::DriverInput {
+
+/**
+ * @brief External driver command source (recorded replay, scenario table, ...)
+ *
+ * Sample() is called from Main20ms with the current simulation time and must
+ * fill throttle/brake/steer for the period starting at t_s. It returns false
+ * once the source is exhausted; the SWC then releases all inputs.
+ */
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+    virtual bool Sample(float t_s, Rte::DriverInput& in) = 0;
+};
+
+void Init(Rte::Context& ctx);
+void Main20ms(Rte::Context& ctx, double dt_s);
+
+// nullptr restores the built-in demo scenario. Not owned; Rte::InitDefaults clears it.
+void SetSource(Rte::Context& ctx, InputSource* source);
+
+// Default RTE instance
 void Init();
 void Main20ms(double dt_s);
-}
\ No newline at end of file
+void SetSource(InputSource* source);
+}
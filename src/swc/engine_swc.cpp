@@ -1,29 +1,30 @@
 #include "swc/engine_swc.h"
 #include "rte/rte.h"
+#include "bsw/diag.h"
 #include <algorithm>
 
 #include "model/engine_model.h"
 
 namespace Swc::Engine {
 
-static Model::EngineParams g_params{};
-
-void Init() {}
+void Init(Rte::Context& /*ctx*/) {}
+void Init() { Init(Rte::DefaultContext()); }
 
 const char* Version() { return "EngineSWC-v0.0.1"; }
 
-void Main10ms(double /*dt_s*/)
+void Main10ms(Rte::Context& ctx, double /*dt_s*/)
 {
-    const auto in = Rte::Rte_Read_DriverInput();
-    const auto sf = Rte::Rte_Read_Safety();
-
-    auto cmd = Rte::Rte_Read_ActuatorCmd();
+    const auto in = Rte::Rte_Read_DriverInput(ctx);
+    const auto sf = Rte::Rte_Read_Safety(ctx);
+    const auto& p = Rte::Rte_Prm_Engine(ctx);
 
     bool estop = sf.estop || sf.system_state == Rte::SystemState::EStop;
 
-    cmd.drive_accel_cmd = Model::ComputeDriveAccel(in.throttle, estop, g_params);
+    Rte::Rte_Write_ActuatorCmd_DriveAccelCmd(ctx, Model::ComputeDriveAccel(in.throttle, estop, p));
 
-    Rte::Rte_Write_ActuatorCmd(cmd);
+    Bsw::Diag::ReportAlive(ctx, Rte::SupervisedEntity::Engine);
 }
 
+void Main10ms(double dt_s) { Main10ms(Rte::DefaultContext(), dt_s); }
+
 } // namespace Swc::Engine
@@ -1,23 +1,33 @@
 #include "swc/safety_swc.h"
 #include "rte/rte.h"
 #include "bsw/diag.h"
+#include <cmath>
 
 namespace Swc::Safety {
 
-void Init() {}
+void Init(Rte::Context& /*ctx*/) {}
+void Init() { Init(Rte::DefaultContext()); }
 const char* Version() { return "SafetySupervisorSWC-v0.0.1"; }
 
-void Main100ms(double /*dt_s*/)
+void Main100ms(Rte::Context& ctx, double dt_s)
 {
-    // v1 skeleton: no per-component heartbeat yet.
-    // This SWC exists so architecture is in place. Extend here later.
-    // Example: if heartbeat stops progressing -> EStop.
-    auto sf = Rte::Rte_Read_Safety();
-    sf.system_state = sf.estop ? Rte::SystemState::EStop : Rte::SystemState::Normal;
-    Rte::Rte_Write_Safety(sf);
+    // Deadline supervision of the runnables since the last 100ms cycle:
+    // Failed -> Degraded, Expired (latched) -> EStop, within this same cycle.
+    const auto sup = Bsw::Diag::Supervise(ctx, std::llround(dt_s * 1000.0));
 
-    // bump system heartbeat for now
-    Bsw::Diag::BumpHeartbeat();
+    auto sf = Rte::Rte_Read_Safety(ctx);
+    if (sf.estop || sup.worst == Rte::SupervisionStatus::Expired) {
+        sf.system_state = Rte::SystemState::EStop;
+    } else if (sup.worst == Rte::SupervisionStatus::Failed) {
+        sf.system_state = Rte::SystemState::Degraded;
+    } else {
+        sf.system_state = Rte::SystemState::Normal;
+    }
+    Rte::Rte_Write_Safety(ctx, sf);
+
+    Bsw::Diag::BumpHeartbeat(ctx);
 }
 
+void Main100ms(double dt_s) { Main100ms(Rte::DefaultContext(), dt_s); }
+
 } // namespace Swc::Safety
@@ -1,6 +1,12 @@
 #pragma once
+namespace Rte { struct Context; }
+
 namespace Swc::Safety {
+void Init(Rte::Context& ctx);
+void Main100ms(Rte::Context& ctx, double dt_s);
+
+// Default RTE instance
 void Init();
 void Main100ms(double dt_s);
 const char* Version();
-}
\ No newline at end of file
+}
@@ -1,40 +1,29 @@
 #include "swc/steering_swc.h"
 #include "rte/rte.h"
-#include <algorithm>
-#include <cmath>
+#include "bsw/diag.h"
+#include "model/steering_model.h"
 
 namespace Swc::Steering {
 
-struct Params {
-    float max_steer_angle_rad = 0.40f; // ~23 deg
-    float steer_tau_s = 0.15f;         // first-order lag
-};
-
-static Params g_params{};
-static float g_steer_angle = 0.0f;
-
-void Init() { g_steer_angle = 0.0f; }
+void Init(Rte::Context& ctx) { ctx.steering.steer_angle = 0.0f; }
+void Init() { Init(Rte::DefaultContext()); }
 const char* Version() { return "SteeringSWC-v0.0.1"; }
 
-void Main10ms(double dt_s)
+void Main10ms(Rte::Context& ctx, double dt_s)
 {
-    const auto in = Rte::Rte_Read_DriverInput();
-    const auto sf = Rte::Rte_Read_Safety();
+    const auto in = Rte::Rte_Read_DriverInput(ctx);
+    const auto sf = Rte::Rte_Read_Safety(ctx);
+    const Params& p = Rte::Rte_Prm_Steering(ctx);
 
-    auto cmd = Rte::Rte_Read_ActuatorCmd();
-
-    float target = 0.0f;
-    if (!sf.estop && sf.system_state != Rte::SystemState::EStop) {
-        const float steer = std::clamp(in.steer, -1.0f, 1.0f);
-        target = steer * g_params.max_steer_angle_rad;
-    }
+    const bool estop = sf.estop || sf.system_state == Rte::SystemState::EStop;
+    const float target = Model::ComputeSteerTarget(in.steer, estop, p);
 
     // First-order lag: d/dt x = (target - x) / tau
-    const float tau = std::max(g_params.steer_tau_s, 1e-3f);
-    g_steer_angle += static_cast<float>((target - g_steer_angle) * (dt_s / tau));
+    Rte::Rte_Write_ActuatorCmd_SteerAngleCmd(ctx, Model::StepSteerLag(ctx.steering.steer_angle, target, dt_s, p));
 
-    cmd.steer_angle_cmd = std::clamp(g_steer_angle, -g_params.max_steer_angle_rad, g_params.max_steer_angle_rad);
-    Rte::Rte_Write_ActuatorCmd(cmd);
+    Bsw::Diag::ReportAlive(ctx, Rte::SupervisedEntity::Steering);
 }
 
+void Main10ms(double dt_s) { Main10ms(Rte::DefaultContext(), dt_s); }
+
 } // namespace Swc::Steering
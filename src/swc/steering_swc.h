@@ -1,6 +1,16 @@
 #pragma once
+#include "model/steering_model.h"
+
+namespace Rte { struct Context; }
+
 namespace Swc::Steering {
+using Params = Model::SteeringParams;
+
+void Init(Rte::Context& ctx);
+void Main10ms(Rte::Context& ctx, double dt_s);
+
+// Default RTE instance
 void Init();
 void Main10ms(double dt_s);
 const char* Version();
-}
\ No newline at end of file
+}
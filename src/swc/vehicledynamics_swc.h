@@ -1,6 +1,16 @@
 #pragma once
+#include "model/bicycle_model.h"
+
+namespace Rte { struct Context; }
+
 namespace Swc::VehicleDynamics {
+using Params = Model::BicycleParams;
+
+void Init(Rte::Context& ctx);
+void Step10ms(Rte::Context& ctx, double dt_s);
+
+// Default RTE instance
 void Init();
 void Step10ms(double dt_s);
 const char* Version();
-}
\ No newline at end of file
+}
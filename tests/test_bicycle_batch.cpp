@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "model/bicycle_batch.h"
+#include "rte/rte.h"
+#include "swc/vehicledynamics_swc.h"
+
+namespace {
+
+bool SameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; }
+
+// Deterministic command profile exercising accel, cruise with steer, brake and estop
+void CommandAt(int k, int vehicle, float& drive, float& brake, float& steer, uint8_t& estop)
+{
+    const float phase = 0.01f * static_cast<float>(vehicle);
+    drive = (k < 200) ? 1.2f + phase : ((k < 500) ? 0.4f : 0.0f);
+    brake = (k >= 500 && k < 700) ? 2.4f - phase : 0.0f;
+    steer = (k >= 200 && k < 500) ? 0.08f - phase : -0.02f * phase;
+    estop = (k >= 800 && k < 850) ? 1 : 0;
+}
+
+} // namespace
+
+TEST_CASE("BicycleBatch: single vehicle matches VehicleDynamicsSWC bit for bit", "[bicycle_batch]") {
+    Rte::InitDefaults();
+    Swc::VehicleDynamics::Init();
+
+    Model::BicycleParams p{};
+    Model::BicycleBatch batch(1);
+
+    for (int k = 0; k < 1000; ++k) {
+        float drive, brake, steer;
+        uint8_t estop;
+        CommandAt(k, 0, drive, brake, steer, estop);
+
+        Rte::ActuatorCmd cmd{};
+        cmd.drive_accel_cmd = drive;
+        cmd.brake_decel_cmd = brake;
+        cmd.steer_angle_cmd = steer;
+        Rte::Rte_Write_ActuatorCmd(cmd);
+        Rte::Safety sf{};
+        sf.estop = estop != 0;
+        Rte::Rte_Write_Safety(sf);
+        Swc::VehicleDynamics::Step10ms(0.01);
+
+        const Model::BicycleBatchInput in{&drive, &brake, &steer, &estop};
+        Model::StepBicycleBatch(batch, 0.01f, in, p);
+
+        const auto st = Rte::Rte_Read_VehicleState();
+        REQUIRE(SameBits(st.t, batch.t));
+        REQUIRE(SameBits(st.x, batch.x[0]));
+        REQUIRE(SameBits(st.y, batch.y[0]));
+        REQUIRE(SameBits(st.yaw, batch.yaw[0]));
+        REQUIRE(SameBits(st.v, batch.v[0]));
+        REQUIRE(SameBits(st.yaw_rate, batch.yaw_rate[0]));
+        REQUIRE(SameBits(st.wheel_omega, batch.wheel_omega[0]));
+    }
+    Rte::InitDefaults();
+}
+
+TEST_CASE("BicycleBatch: N vehicles match N independent scalar steps", "[bicycle_batch]") {
+    constexpr int kVehicles = 37; // not a multiple of any vector width
+    Model::BicycleParams p{};
+    Model::BicycleBatch batch(kVehicles);
+    std::vector<Model::BicycleState> scalar(kVehicles);
+
+    std::vector<float> drive(kVehicles), brake(kVehicles), steer(kVehicles);
+    std::vector<uint8_t> estop(kVehicles);
+    const Model::BicycleBatchInput in{drive.data(), brake.data(), steer.data(), estop.data()};
+
+    for (int k = 0; k < 1000; ++k) {
+        for (int i = 0; i < kVehicles; ++i) {
+            CommandAt(k, i, drive[i], brake[i], steer[i], estop[i]);
+            Model::StepBicycle(scalar[i], 0.01f, drive[i], brake[i], steer[i], estop[i] != 0, p);
+        }
+        Model::StepBicycleBatch(batch, 0.01f, in, p);
+    }
+
+    for (int i = 0; i < kVehicles; ++i) {
+        const auto b = batch.Get(i);
+        REQUIRE(SameBits(b.x, scalar[i].x));
+        REQUIRE(SameBits(b.y, scalar[i].y));
+        REQUIRE(SameBits(b.yaw, scalar[i].yaw));
+        REQUIRE(SameBits(b.v, scalar[i].v));
+        REQUIRE(SameBits(b.yaw_rate, scalar[i].yaw_rate));
+        REQUIRE(SameBits(b.wheel_omega, scalar[i].wheel_omega));
+    }
+}
@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "app/ecu.h"
+#include "bsw/calib_store.h"
+
+namespace {
+
+void WriteFile(const std::filesystem::path& p, const std::string& text)
+{
+    std::ofstream f(p, std::ios::trunc);
+    f << text;
+}
+
+// Every named float field set to v
+Rte::Calibration Uniform(float v)
+{
+    Rte::Calibration c{};
+    for (const auto& p : Bsw::Calib::Params()) p.field(c) = v;
+    return c;
+}
+
+} // namespace
+
+TEST_CASE("Calib: parse overrides named fields and rejects bad lines", "[calib]") {
+    Rte::Calibration c{};
+    std::string err;
+    REQUIRE(Bsw::Calib::Parse("# comment\n\nbrake.max_decel_mps2 = 5.5  # tuned\n  vehicle.max_speed_mps=2\n", c, err));
+    REQUIRE(c.brake.max_decel_mps2 == 5.5f);
+    REQUIRE(c.vehicle.max_speed_mps == 2.0f);
+    REQUIRE(c.engine.max_accel_mps2 == Model::EngineParams{}.max_accel_mps2);
+
+    const Rte::Calibration before = c;
+    REQUIRE_FALSE(Bsw::Calib::Parse("brake.max_decel_mps2 = 1\nbrake.max_jerk = 3\n", c, err));
+    REQUIRE(err.find("line 2") != std::string::npos);
+    REQUIRE_FALSE(Bsw::Calib::Parse("brake.max_decel_mps2 = fast\n", c, err));
+    REQUIRE(c.brake.max_decel_mps2 == before.brake.max_decel_mps2); // all-or-nothing
+
+    // The shipped file reproduces the compiled-in defaults
+    Rte::Calibration file = Uniform(-1.0f);
+    REQUIRE(Bsw::Calib::LoadFile(std::string(SDV_SOURCE_DIR) + "/calibration/v1_default.calib", file, err));
+    const Rte::Calibration def{};
+    for (const auto& p : Bsw::Calib::Params()) {
+        Rte::Calibration a = def;
+        REQUIRE(p.field(file) == p.field(a));
+    }
+}
+
+TEST_CASE("Calib: store reloads on change and applies between ticks", "[calib]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_calib_store";
+    std::filesystem::create_directories(dir);
+    const auto path = dir / "live.calib";
+    WriteFile(path, "vehicle.max_speed_mps = 1.0\n");
+
+    Bsw::Calib::Store store;
+    std::string err;
+    Rte::Calibration base{};
+    base.brake.max_decel_mps2 = 3.0f;
+    REQUIRE(store.Open(path.string(), base, err));
+
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    const uint32_t seq = Rte::Rte_Seq_Calibration(ctx);
+    REQUIRE(store.Apply(ctx));
+    REQUIRE(ctx.calib.vehicle.max_speed_mps == 1.0f);
+    REQUIRE(ctx.calib.brake.max_decel_mps2 == 3.0f);
+    REQUIRE(Rte::Rte_Seq_Calibration(ctx) == seq + 1); // data-triggered runnables see the swap
+    REQUIRE_FALSE(store.Apply(ctx)); // nothing new
+    REQUIRE(Rte::Rte_Seq_Calibration(ctx) == seq + 1);
+    REQUIRE_FALSE(store.Poll(err));  // file unchanged
+
+    // Run with the prologue: the speed cap changes at a tick boundary
+    Bsw::TimeBase::Scheduler sched;
+    App::RegisterTasks(sched, ctx);
+    sched.SetTickPrologue([&] { store.Apply(ctx); });
+    sched.RunForSeconds(2.0);
+    REQUIRE(Rte::Rte_Read_VehicleState(ctx).v <= 1.0f);
+
+    WriteFile(path, "vehicle.max_speed_mps = 1.5\nengine.max_accel_mps2 = 3\n");
+    REQUIRE(store.Reload(err));
+    REQUIRE(store.Generation() == 2);
+    sched.RunForSeconds(0.5);
+    REQUIRE(ctx.calib.vehicle.max_speed_mps == 1.5f);
+    REQUIRE(Rte::Rte_Read_VehicleState(ctx).v > 1.0f);
+
+    // A broken edit keeps the previous set
+    WriteFile(path, "vehicle.max_speed_mps = \n");
+    REQUIRE_FALSE(store.Reload(err));
+    REQUIRE_FALSE(store.Apply(ctx));
+    REQUIRE(ctx.calib.vehicle.max_speed_mps == 1.5f);
+    REQUIRE(ctx.calib.brake.max_decel_mps2 == 3.0f); // base is kept across reloads
+}
+
+TEST_CASE("Calib: a reload with an out-of-range or non-finite value is not published", "[calib]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_calib_range";
+    std::filesystem::create_directories(dir);
+    const auto path = dir / "live.calib";
+    WriteFile(path, "vehicle.max_speed_mps = 2.0\n");
+
+    Bsw::Calib::Store store;
+    std::string err;
+    REQUIRE(store.Open(path.string(), Rte::Calibration{}, err));
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    REQUIRE(store.Apply(ctx));
+
+    // Each file is rejected as a whole, even with valid lines before the bad one
+    for (const char* bad : {"engine.max_accel_mps2 = 3\nvehicle.max_speed_mps = -1\n",
+                            "vehicle.max_speed_mps = nan\n", "brake.max_decel_mps2 = inf\n",
+                            "vehicle.max_speed_mps = 0\n", "steering.steer_tau_s = 1e9\n",
+                            "vehicle.wheel_radius_m = -0.03\n"}) {
+        WriteFile(path, bad);
+        REQUIRE_FALSE(store.Reload(err));
+        REQUIRE(err.find("outside") != std::string::npos);
+        REQUIRE_FALSE(store.Apply(ctx));
+    }
+    REQUIRE(store.Generation() == 1);
+    REQUIRE(ctx.calib.vehicle.max_speed_mps == 2.0f);
+    REQUIRE(ctx.calib.engine.max_accel_mps2 == Model::EngineParams{}.max_accel_mps2);
+
+    // Every range admits the compiled-in default
+    for (const auto& p : Bsw::Calib::Params()) {
+        Rte::Calibration def{};
+        REQUIRE(p.range.Contains(p.field(def)));
+    }
+}
+
+TEST_CASE("Calib: a concurrent reader never sees a torn set", "[calib]") {
+    Bsw::Calib::Store store;
+    Rte::Context ctx;
+    ctx.calib = Uniform(0.0f);
+
+    constexpr int kSets = 20000;
+    std::atomic<bool> done{false};
+    std::thread loader([&] {
+        for (int k = 1; k <= kSets; ++k) store.Publish(Uniform(static_cast<float>(k)));
+        done.store(true, std::memory_order_release);
+    });
+
+    bool torn = false;
+    bool monotonic = true;
+    float last = 0.0f;
+    for (;;) {
+        const bool finished = done.load(std::memory_order_acquire);
+        if (!store.Apply(ctx)) {
+            if (finished) break; // everything published before `done` has been seen
+            continue;
+        }
+        const float v = Bsw::Calib::Params().front().field(ctx.calib);
+        for (const auto& p : Bsw::Calib::Params()) torn = torn || p.field(ctx.calib) != v;
+        monotonic = monotonic && v > last;
+        last = v;
+    }
+    loader.join();
+
+    REQUIRE_FALSE(torn);
+    REQUIRE(monotonic);
+    REQUIRE(Bsw::Calib::Params().back().field(ctx.calib) == static_cast<float>(kSets));
+    REQUIRE(store.Generation() == kSets);
+}
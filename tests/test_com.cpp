@@ -0,0 +1,208 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "app/com_input.h"
+#include "app/ecu.h"
+#include "bsw/com.h"
+#include "rte/rte.h"
+
+namespace {
+
+std::string UniqueName(const char* tag)
+{
+    return std::string("/sdv_test_com_") + tag + "_" + std::to_string(::getpid());
+}
+
+} // namespace
+
+TEST_CASE("Com: subscribers see every sample in order and count what they missed", "[com]") {
+    auto ring = std::make_unique<Bsw::Com::ShmRing<Rte::VehicleState, 8>>();
+    Bsw::Com::Subscriber<Rte::VehicleState, 8> early(*ring);
+    Bsw::Com::Sample<Rte::VehicleState> s;
+    REQUIRE_FALSE(early.Next(s));
+    REQUIRE_FALSE(ring->Latest(s));
+
+    for (int k = 0; k < 5; ++k) {
+        Rte::VehicleState v;
+        v.t = static_cast<float>(k);
+        ring->Publish(v, 1000 + k);
+    }
+    for (int k = 0; k < 5; ++k) {
+        REQUIRE(early.Next(s));
+        REQUIRE(s.seq == static_cast<uint64_t>(k));
+        REQUIRE(s.stamp_ns == 1000 + k);
+        REQUIRE(s.value.t == static_cast<float>(k));
+    }
+    REQUIRE_FALSE(early.Next(s));
+
+    // Lapped by 12 - 8 = 4 samples: those are lost, the 8 still in the ring are not
+    Bsw::Com::Subscriber<Rte::VehicleState, 8> late(*ring);
+    for (int k = 5; k < 17; ++k) {
+        Rte::VehicleState v;
+        v.t = static_cast<float>(k);
+        ring->Publish(v);
+    }
+    int got = 0;
+    while (late.Next(s)) ++got;
+    REQUIRE(got == 8);
+    REQUIRE(late.Lost() == 4);
+    REQUIRE(s.value.t == 16.0f);
+    REQUIRE_FALSE(ring->Read(8, s)); // overwritten
+    REQUIRE(ring->Latest(s));
+    REQUIRE(s.seq == 16);
+}
+
+TEST_CASE("Com: concurrent readers never see a torn sample", "[com]") {
+    auto ring = std::make_unique<Bsw::Com::ShmRing<Rte::VehicleState, 4>>();
+    constexpr int kSamples = 200000;
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> reads{0};
+    std::thread reader([&] {
+        Bsw::Com::Subscriber<Rte::VehicleState, 4> sub(*ring, true);
+        Bsw::Com::Sample<Rte::VehicleState> s;
+        while (!done.load(std::memory_order_acquire)) {
+            while (sub.Next(s)) {
+                const float k = s.value.t;
+                if (s.value.x != k || s.value.y != k || s.value.wheel_omega != k ||
+                    s.stamp_ns != static_cast<int64_t>(k)) {
+                    torn.fetch_add(1);
+                }
+                reads.fetch_add(1, std::memory_order_relaxed);
+            }
+            std::this_thread::yield();
+        }
+    });
+    for (int k = 0; k < kSamples; ++k) {
+        Rte::VehicleState v;
+        v.t = v.x = v.y = v.wheel_omega = static_cast<float>(k);
+        ring->Publish(v, k);
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+    REQUIRE(torn.load() == 0);
+    REQUIRE(reads.load() > 0);
+}
+
+TEST_CASE("Com: segment attach checks and the single input producer", "[com]") {
+    const std::string name = UniqueName("seg");
+    Bsw::Com::Segment ecu;
+    Bsw::Com::Segment peer;
+    std::string err;
+    REQUIRE_FALSE(peer.Attach(name, err));
+    REQUIRE_FALSE(err.empty());
+
+    REQUIRE(ecu.Create(name, err));
+    REQUIRE(peer.Attach(name, err));
+    REQUIRE(peer->header.ecu_pid.load() == static_cast<int32_t>(::getpid()));
+
+    // Both mappings are the same memory
+    Rte::DriverInput in;
+    in.throttle = 0.25f;
+    peer->input.Publish(in, 7);
+    Bsw::Com::Sample<Rte::DriverInput> s;
+    REQUIRE(ecu->input.Latest(s));
+    REQUIRE(s.value.throttle == 0.25f);
+    REQUIRE(s.stamp_ns == 7);
+
+    // A live process holding the input ring keeps it; a dead one loses it
+    peer->header.input_pid.store(static_cast<int32_t>(::getppid()));
+    REQUIRE_FALSE(peer.ClaimInput(err));
+    const pid_t child = ::fork();
+    if (child == 0) _exit(0);
+    ::waitpid(child, nullptr, 0);
+    peer->header.input_pid.store(static_cast<int32_t>(child));
+    REQUIRE(peer.ClaimInput(err));
+    REQUIRE(peer->header.input_pid.load() == static_cast<int32_t>(::getpid()));
+    peer.Close();
+    REQUIRE(ecu->header.input_pid.load() == 0);
+
+    // A second ECU must not replace the segment of a live one
+    Bsw::Com::Segment second;
+    REQUIRE_FALSE(second.Create(name, err));
+    REQUIRE(err.find("in use by pid " + std::to_string(::getpid())) != std::string::npos);
+    REQUIRE(peer.Attach(name, err));
+    REQUIRE(peer->input.Latest(s)); // still the original rings
+    peer.Close();
+
+    // The creator unlinks the name on close
+    ecu.Close();
+    REQUIRE_FALSE(peer.Attach(name, err));
+
+    // The segment of a crashed ECU (still named, creator gone without Close) is
+    // replaced, even if its recorded pid now belongs to a live process
+    const pid_t crashed = ::fork();
+    if (crashed == 0) {
+        Bsw::Com::Segment ecu2;
+        std::string child_err;
+        _exit(ecu2.Create(name, child_err) ? 0 : 1); // no destructor: the name stays behind
+    }
+    int status = 0;
+    ::waitpid(crashed, &status, 0);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+    REQUIRE(peer.Attach(name, err));
+    REQUIRE(peer->header.ecu_pid.load() == static_cast<int32_t>(crashed));
+    peer->header.ecu_pid.store(static_cast<int32_t>(::getppid())); // as if the pid had been reused
+    peer.Close();
+    REQUIRE(second.Create(name, err));
+    REQUIRE(second->header.ecu_pid.load() == static_cast<int32_t>(::getpid()));
+    second.Close();
+    ::shm_unlink((name + ".lock").c_str());
+}
+
+TEST_CASE("Com: the ECU publishes its signals and drives from injected input", "[com]") {
+    const std::string name = UniqueName("ecu");
+    std::string err;
+    REQUIRE(Bsw::Com::Init(name, err));
+    REQUIRE(Bsw::Com::IsActive());
+
+    Bsw::Com::Segment peer;
+    REQUIRE(peer.Attach(name, err));
+    REQUIRE(peer.ClaimInput(err));
+    Bsw::Com::Subscriber<Rte::VehicleState> state(peer->vehicle_state);
+    Bsw::Com::Subscriber<Rte::DriverInput> applied(peer->driver_input);
+
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    App::ComInputSource source(std::chrono::seconds(60));
+    Swc::DriverInput::SetSource(ctx, &source);
+
+    SECTION("no producer: pedals released") {
+        App::StaticScheduler::RunForSeconds(1.0, ctx);
+        REQUIRE(source.StalePeriods() == 50);
+        REQUIRE(Rte::Rte_Read_VehicleState(ctx).v == 0.0f);
+    }
+    SECTION("injected throttle drives the vehicle") {
+        Rte::DriverInput in;
+        in.throttle = 2.0f; // clamped by the SWC; subscribers see the applied value
+        peer->input.Publish(in);
+        App::StaticScheduler::RunForSeconds(1.0, ctx);
+        REQUIRE(source.StalePeriods() == 0);
+        REQUIRE(Bsw::Com::GetStats().input_samples == 1);
+
+        const auto st = Rte::Rte_Read_VehicleState(ctx);
+        REQUIRE(st.v > 0.0f);
+        Bsw::Com::Sample<Rte::VehicleState> s;
+        int n = 0;
+        while (state.Next(s)) ++n;
+        REQUIRE(n == 100);
+        REQUIRE(s.value.t == st.t);
+        REQUIRE(s.value.x == st.x);
+        Bsw::Com::Sample<Rte::DriverInput> a;
+        REQUIRE(applied.Latest(a));
+        REQUIRE(a.value.throttle == 1.0f);
+    }
+
+    Bsw::Com::Shutdown();
+    REQUIRE_FALSE(Bsw::Com::IsActive());
+    ::shm_unlink((name + ".lock").c_str()); // the lock object outlives the segment by design
+}
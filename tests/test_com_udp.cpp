@@ -0,0 +1,278 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "app/com_input.h"
+#include "app/ecu.h"
+#include "bsw/com.h"
+#include "rte/rte.h"
+
+namespace {
+
+// Receives until at least one datagram arrived or 1 s passed, decoding all of them
+std::vector<Bsw::Com::PduBatch> ReceiveAll(Bsw::Com::UdpSocket& sock)
+{
+    std::vector<Bsw::Com::PduBatch> out;
+    if (!sock.WaitReadable(1000)) return out;
+    std::size_t n;
+    while ((n = sock.Receive()) > 0) {
+        for (std::size_t i = 0; i < n; ++i) {
+            Bsw::Com::PduBatch b;
+            if (Bsw::Com::DecodeDatagram(sock.RxData(i), sock.RxSize(i), b)) out.push_back(b);
+        }
+    }
+    return out;
+}
+
+void SendInput(Bsw::Com::UdpSocket& sock, uint16_t cycle, float throttle, uint32_t session = 1)
+{
+    Bsw::Com::DatagramBuilder b;
+    b.SetSession(session);
+    Rte::DriverInput in;
+    in.throttle = throttle;
+    b.Add(cycle, in);
+    b.Finish(cycle, Bsw::Com::NowNs());
+    REQUIRE(sock.Send(b) == 1);
+}
+
+// Polls until the gateway has seen `count` DriverInput PDUs in total (or 1 s passed)
+void PollUntil(Bsw::Com::UdpGateway& gw, uint64_t count)
+{
+    for (int k = 0; k < 100; ++k) {
+        gw.Poll();
+        const auto s = gw.Stats();
+        if (s.inputs + s.stale_inputs >= count) return;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+} // namespace
+
+TEST_CASE("Com UDP: PDUs round-trip and datagrams split at the size limit", "[com_udp]") {
+    Bsw::Com::DatagramBuilder b;
+    Rte::DriverInput in{0.25f, 0.5f, -0.75f};
+    Rte::ActuatorCmd cmd{1.5f, 2.5f, -0.1f};
+    Rte::VehicleState st;
+    st.t = 1.23f;
+    st.x = -4.5f;
+    st.wheel_omega = 99.0f;
+    Rte::Safety sf{true, Rte::SystemState::Degraded};
+    b.Add(7, in);
+    b.Add(7, cmd);
+    b.Add(8, st);
+    b.Add(8, sf);
+    b.SetSession(0xdeadbeef);
+    b.Finish(41, 123456789);
+    REQUIRE(b.DatagramCount() == 1);
+    REQUIRE(b.PduCount() == 4);
+    // 20 header + 4 x 4 PDU headers + 12 + 12 + 28 + 2 payload
+    REQUIRE(b.Datagram(0).size() == 90);
+
+    Bsw::Com::PduBatch out;
+    REQUIRE(Bsw::Com::DecodeDatagram(b.Datagram(0).data(), b.Datagram(0).size(), out));
+    REQUIRE(out.session == 0xdeadbeef);
+    REQUIRE(out.seq == 41);
+    REQUIRE(out.stamp_ns == 123456789);
+    REQUIRE(out.pdus.size() == 4);
+    REQUIRE(out.pdus[0].id == Bsw::Com::PduId::DriverInput);
+    REQUIRE(out.pdus[0].cycle == 7);
+    REQUIRE(out.pdus[0].driver_input.steer == -0.75f);
+    REQUIRE(out.pdus[1].actuator_cmd.brake_decel_cmd == 2.5f);
+    REQUIRE(out.pdus[2].cycle == 8);
+    REQUIRE(out.pdus[2].vehicle_state.x == -4.5f);
+    REQUIRE(out.pdus[2].vehicle_state.wheel_omega == 99.0f);
+    REQUIRE(out.pdus[3].safety.estop);
+    REQUIRE(out.pdus[3].safety.system_state == Rte::SystemState::Degraded);
+
+    // 100 cycles of VehicleState (32 B each) do not fit one 1400 B datagram
+    b.Clear();
+    for (uint16_t c = 0; c < 100; ++c) b.Add(c, st);
+    b.Finish(0, 0);
+    REQUIRE(b.DatagramCount() == 3);
+    std::size_t pdus = 0;
+    for (std::size_t i = 0; i < b.DatagramCount(); ++i) {
+        REQUIRE(b.Datagram(i).size() <= Bsw::Com::kMaxDatagramBytes);
+        REQUIRE(Bsw::Com::DecodeDatagram(b.Datagram(i).data(), b.Datagram(i).size(), out));
+        REQUIRE(out.seq == i);
+        REQUIRE(out.pdus.front().cycle == pdus);
+        pdus += out.pdus.size();
+    }
+    REQUIRE(pdus == 100);
+}
+
+TEST_CASE("Com UDP: malformed datagrams are rejected, unknown PDUs skipped", "[com_udp]") {
+    Bsw::Com::DatagramBuilder b;
+    b.Add(3, Rte::DriverInput{0.5f, 0.0f, 0.0f});
+    b.Finish(9, 1);
+    const std::vector<uint8_t> good = b.Datagram(0);
+
+    Bsw::Com::PduBatch out;
+    out.seq = 1234;
+    auto rejected = [&](std::vector<uint8_t> d) {
+        return !Bsw::Com::DecodeDatagram(d.data(), d.size(), out) && out.seq == 1234;
+    };
+    std::vector<uint8_t> d = good;
+    d[0] = 'X';
+    REQUIRE(rejected(d));
+    d = good;
+    d[2] = 1; // older version
+    REQUIRE(rejected(d));
+    d = good;
+    d.pop_back(); // truncated payload
+    REQUIRE(rejected(d));
+    d = good;
+    d.push_back(0); // trailing garbage
+    REQUIRE(rejected(d));
+    d = good;
+    d[3] = 2; // claims a second PDU
+    REQUIRE(rejected(d));
+    d = good;
+    d[21] = 8; // wrong length for a DriverInput
+    REQUIRE(rejected(d));
+    REQUIRE(rejected(std::vector<uint8_t>(good.begin(), good.begin() + 10)));
+
+    // A PDU id from a newer sender is skipped by its length
+    d = good;
+    d[3] = 2;
+    for (uint8_t byte : {uint8_t{200}, uint8_t{3}, uint8_t{0}, uint8_t{0}, uint8_t{1}, uint8_t{2}, uint8_t{3}}) {
+        d.push_back(byte);
+    }
+    REQUIRE(Bsw::Com::DecodeDatagram(d.data(), d.size(), out));
+    REQUIRE(out.pdus.size() == 1);
+    REQUIRE(out.pdus[0].driver_input.throttle == 0.5f);
+}
+
+TEST_CASE("Com UDP: the gateway keeps the newest input and answers its sender", "[com_udp]") {
+    Bsw::Com::UdpGateway gw;
+    Bsw::Com::UdpSocket station;
+    std::string err;
+    Bsw::Com::UdpConfig cfg;
+    cfg.batch_cycles = 5;
+    REQUIRE(gw.Open(cfg, err));
+    REQUIRE(gw.LocalPort() != 0);
+    REQUIRE(station.Open(0, err));
+    station.SetPeer(gw.LocalPort());
+
+    Rte::DriverInput in;
+    uint16_t cycle = 0;
+    int64_t rx_ns = 0;
+    REQUIRE_FALSE(gw.LatestInput(in, cycle, rx_ns));
+
+    SendInput(station, 100, 0.1f);
+    SendInput(station, 101, 0.2f);
+    SendInput(station, 99, 0.9f); // late: must not roll the input back
+    PollUntil(gw, 3);
+    REQUIRE(gw.LatestInput(in, cycle, rx_ns));
+    REQUIRE(cycle == 101);
+    REQUIRE(in.throttle == 0.2f);
+    REQUIRE(gw.Stats().stale_inputs == 1);
+
+    // Counter wrap is newer; so is any counter from a newer session (a restarted station)
+    SendInput(station, 20000, 0.3f);
+    SendInput(station, 40000, 0.3f);
+    SendInput(station, 65535, 0.3f);
+    SendInput(station, 2, 0.4f);
+    PollUntil(gw, 7);
+    REQUIRE(gw.LatestInput(in, cycle, rx_ns));
+    REQUIRE(cycle == 2);
+    REQUIRE(in.throttle == 0.4f);
+    SendInput(station, 0, 0.5f);
+    SendInput(station, 30000, 0.6f);
+    SendInput(station, 29990, 0.7f, 2); // restarted within a few cycles of the old counter
+    SendInput(station, 30001, 0.8f, 1); // late datagram from before the restart
+    PollUntil(gw, 11);
+    REQUIRE(gw.LatestInput(in, cycle, rx_ns));
+    REQUIRE(cycle == 29990);
+    REQUIRE(in.throttle == 0.7f);
+    REQUIRE(gw.Stats().stale_inputs == 3);
+    REQUIRE(gw.Stats().restarts == 1);
+
+    // Neither an empty nor a stale datagram from elsewhere redirects the replies
+    Bsw::Com::UdpSocket stray;
+    REQUIRE(stray.Open(0, err));
+    stray.SetPeer(gw.LocalPort());
+    Bsw::Com::DatagramBuilder empty;
+    empty.StartDatagram();
+    empty.Finish(0, 0);
+    REQUIRE(stray.Send(empty) == 1);
+    SendInput(stray, 40000, 0.9f, 1);
+    PollUntil(gw, 12);
+    REQUIRE(gw.Stats().datagrams_rx == 13);
+    REQUIRE(gw.Stats().stale_inputs == 4);
+
+    // Signals go back to the station, five 10ms cycles per send
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    for (int k = 0; k < 4; ++k) {
+        App::VehicleDynamics_10ms(ctx);
+        gw.Tick10ms(ctx);
+    }
+    REQUIRE(gw.Stats().datagrams_tx == 0);
+    App::VehicleDynamics_10ms(ctx);
+    gw.Tick10ms(ctx);
+    const auto batches = ReceiveAll(station);
+    REQUIRE(batches.size() == 1);
+    int states = 0;
+    uint16_t last_cycle = 0;
+    for (const auto& e : batches[0].pdus) {
+        if (e.id != Bsw::Com::PduId::VehicleState) continue;
+        REQUIRE((states == 0 || e.cycle == last_cycle + 1));
+        last_cycle = e.cycle;
+        ++states;
+    }
+    REQUIRE(states == 5);
+    REQUIRE(gw.Stats().datagrams_tx == 1);
+    REQUIRE(gw.Stats().send_calls == 1);
+    REQUIRE_FALSE(stray.WaitReadable(0));
+
+    // Close() sends a partly filled batch
+    App::VehicleDynamics_10ms(ctx);
+    gw.Tick10ms(ctx);
+    gw.Close();
+    const auto tail = ReceiveAll(station);
+    REQUIRE(tail.size() == 1);
+    REQUIRE(tail[0].pdus.size() >= 1);
+}
+
+TEST_CASE("Com UDP: received driver input takes effect at the 20ms boundary", "[com_udp]") {
+    Bsw::Com::UdpConfig cfg;
+    std::string err;
+    REQUIRE(Bsw::Com::InitUdp(cfg, err));
+    REQUIRE(Bsw::Com::IsActive());
+    Bsw::Com::UdpSocket station;
+    REQUIRE(station.Open(0, err));
+    station.SetPeer(Bsw::Com::UdpLocalPort());
+
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    App::ComInputSource source(std::chrono::seconds(60), App::ComInputSource::Transport::Udp);
+    Swc::DriverInput::SetSource(ctx, &source);
+
+    SendInput(station, 1, 0.8f);
+    // 10ms tasks alone leave the RTE untouched, however long the datagram waits
+    for (int k = 0; k < 3; ++k) App::Tasks10ms::Run(ctx);
+    REQUIRE(Rte::Rte_Read_DriverInput(ctx).throttle == 0.0f);
+    Swc::DriverInput::Main20ms(ctx, 0.02);
+    REQUIRE(Rte::Rte_Read_DriverInput(ctx).throttle == 0.8f);
+    REQUIRE(source.StalePeriods() == 0);
+
+    // The ECU replies to the station, which it learned from the input datagram
+    App::Tasks10ms::Run(ctx);
+    bool got_input_echo = false;
+    for (const auto& b : ReceiveAll(station)) {
+        for (const auto& e : b.pdus) {
+            if (e.id == Bsw::Com::PduId::DriverInput) got_input_echo = e.driver_input.throttle == 0.8f;
+        }
+    }
+    REQUIRE(got_input_echo);
+
+    App::StaticScheduler::RunForSeconds(1.0, ctx);
+    REQUIRE(Rte::Rte_Read_VehicleState(ctx).v > 0.0f);
+    REQUIRE(Bsw::Com::GetUdpStats().inputs == 1);
+
+    Bsw::Com::Shutdown();
+    REQUIRE_FALSE(Bsw::Com::IsActive());
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include "app/ecu.h"
+#include "bsw/diag.h"
+#include "swc/safety_swc.h"
+
+namespace {
+
+using Rte::SupervisedEntity;
+using Rte::SupervisionStatus;
+using Rte::SystemState;
+
+// Drives the alive indications of the ECU task table by hand (10ms entities
+// every tick, DriverInput every other tick) and runs Safety every 10th tick.
+// skip(entity, tick) == true suppresses one indication.
+template <typename Skip>
+void RunTicks(Rte::Context& ctx, int first, int last, Skip skip)
+{
+    for (int k = first; k < last; ++k) {
+        for (auto e : {SupervisedEntity::Engine, SupervisedEntity::Brake, SupervisedEntity::Steering,
+                       SupervisedEntity::VehicleDynamics}) {
+            if (!skip(e, k)) Bsw::Diag::ReportAlive(ctx, e);
+        }
+        if (k % 2 == 0 && !skip(SupervisedEntity::DriverInput, k)) {
+            Bsw::Diag::ReportAlive(ctx, SupervisedEntity::DriverInput);
+        }
+        if (k % 10 == 0) Swc::Safety::Main100ms(ctx, App::kDt100ms);
+    }
+}
+
+SystemState State(const Rte::Context& ctx) { return Rte::Rte_Read_Safety(ctx).system_state; }
+
+} // namespace
+
+TEST_CASE("Diag: full ECU run meets every deadline", "[diag]") {
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    Bsw::TimeBase::Scheduler sched;
+    App::RegisterTasks(sched, ctx);
+    sched.RunForSeconds(10.0);
+
+    for (std::size_t i = 0; i < Rte::kSupervisedEntities; ++i) {
+        const auto e = static_cast<SupervisedEntity>(i);
+        REQUIRE(Bsw::Diag::GetStatus(ctx, e) == SupervisionStatus::Ok);
+        REQUIRE(Bsw::Diag::GetMissedDeadlines(ctx, e) == 0);
+        REQUIRE(ctx.diag.monitor[i].started);
+    }
+    REQUIRE(ctx.diag.alive[static_cast<std::size_t>(SupervisedEntity::Engine)].count.load() == 1000);
+    REQUIRE(State(ctx) == SystemState::Normal);
+}
+
+TEST_CASE("Diag: a stalled runnable degrades within one cycle, then latches EStop", "[diag]") {
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    auto engine_stalled_from = [](int from) {
+        return [from](SupervisedEntity e, int k) { return e == SupervisedEntity::Engine && k >= from; };
+    };
+
+    RunTicks(ctx, 0, 101, engine_stalled_from(1000));
+    REQUIRE(State(ctx) == SystemState::Normal);
+
+    // Engine stops after tick 100; the very next supervision (tick 110) reports it
+    RunTicks(ctx, 101, 111, engine_stalled_from(101));
+    REQUIRE(Bsw::Diag::GetStatus(ctx, SupervisedEntity::Engine) == SupervisionStatus::Failed);
+    REQUIRE(Bsw::Diag::GetMissedDeadlines(ctx, SupervisedEntity::Engine) == 9); // 110 ms + 10 ms tolerance
+    REQUIRE(State(ctx) == SystemState::Degraded);
+
+    // failed_cycles_tolerance = 2: the third failed cycle expires
+    RunTicks(ctx, 111, 121, engine_stalled_from(101));
+    REQUIRE(State(ctx) == SystemState::Degraded);
+    RunTicks(ctx, 121, 131, engine_stalled_from(101));
+    REQUIRE(Bsw::Diag::GetStatus(ctx, SupervisedEntity::Engine) == SupervisionStatus::Expired);
+    REQUIRE(State(ctx) == SystemState::EStop);
+
+    // Latched: the engine coming back does not clear it, only Diag::Init does
+    RunTicks(ctx, 131, 201, engine_stalled_from(1000));
+    REQUIRE(State(ctx) == SystemState::EStop);
+    REQUIRE(Bsw::Diag::GetStatus(ctx, SupervisedEntity::Brake) == SupervisionStatus::Ok);
+}
+
+TEST_CASE("Diag: tolerance absorbs a single late indication", "[diag]") {
+    auto drop_one = [](SupervisedEntity e, int k) { return e == SupervisedEntity::Steering && k == 55; };
+
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    RunTicks(ctx, 0, 101, drop_one);
+    REQUIRE(Bsw::Diag::GetMissedDeadlines(ctx, SupervisedEntity::Steering) == 0);
+    REQUIRE(State(ctx) == SystemState::Normal);
+
+    Rte::Context strict;
+    strict.calib.supervision[static_cast<std::size_t>(SupervisedEntity::Steering)].tolerance_ms = 0;
+    App::InitEcu(strict);
+    RunTicks(strict, 0, 61, drop_one);
+    REQUIRE(Bsw::Diag::GetMissedDeadlines(strict, SupervisedEntity::Steering) == 1);
+    REQUIRE(State(strict) == SystemState::Degraded);
+    RunTicks(strict, 61, 71, drop_one);
+    REQUIRE(State(strict) == SystemState::Normal); // recovers after a clean cycle
+}
+
+TEST_CASE("Diag: unstarted entities are not supervised, alive slots are thread-safe", "[diag]") {
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    for (int k = 0; k < 10; ++k) Swc::Safety::Main100ms(ctx, App::kDt100ms);
+    REQUIRE(State(ctx) == SystemState::Normal);
+    REQUIRE_FALSE(ctx.diag.monitor[0].started);
+
+    constexpr uint32_t kBumps = 200000;
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < Rte::kSupervisedEntities; ++i) {
+        threads.emplace_back([&ctx, i] {
+            for (uint32_t n = 0; n < kBumps; ++n) {
+                Bsw::Diag::ReportAlive(ctx, static_cast<SupervisedEntity>(i));
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    for (const auto& slot : ctx.diag.alive) REQUIRE(slot.count.load() == kBumps);
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "model/bicycle_batch.h"
+#include "model/bicycle_simd.h"
+#include "model/fast_trig.h"
+#include "model/steering_model.h"
+
+namespace {
+
+bool SameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; }
+
+double MaxTanRelError(double range, long samples)
+{
+    double worst = 0.0;
+    for (long i = -samples; i <= samples; ++i) {
+        const auto x = static_cast<float>(range * static_cast<double>(i) / static_cast<double>(samples));
+        const double ref = std::tan(static_cast<double>(x));
+        if (ref == 0.0) continue;
+        worst = std::max(worst, std::fabs(Model::FastTrig::Tan(x) - ref) / std::fabs(ref));
+    }
+    return worst;
+}
+
+// Deterministic commands: steering sweeps the full +-max_steer range, some estops
+void Commands(int k, std::size_t n, std::vector<float>& drive, std::vector<float>& brake,
+              std::vector<float>& steer, std::vector<uint8_t>& estop)
+{
+    const float max_steer = Model::SteeringParams{}.max_steer_angle_rad;
+    for (std::size_t i = 0; i < n; ++i) {
+        const float phase = static_cast<float>((static_cast<std::size_t>(k) + 13 * i) % 200) / 100.0f - 1.0f;
+        drive[i] = (k < 300) ? 1.5f : 0.3f;
+        brake[i] = (k >= 700 && i % 3 == 0) ? 2.0f : 0.0f;
+        steer[i] = max_steer * phase;
+        estop[i] = (k >= 900 && i % 5 == 0) ? 1 : 0;
+    }
+}
+
+} // namespace
+
+TEST_CASE("FastTrig: sin/cos absolute error bound over |x| <= 8192", "[fast_trig]") {
+    double worst_s = 0.0;
+    double worst_c = 0.0;
+    constexpr long kSamples = 2000000;
+    for (long i = -kSamples; i <= kSamples; ++i) {
+        const auto x = static_cast<float>(8192.0 * static_cast<double>(i) / kSamples);
+        float s, c;
+        Model::FastTrig::SinCos(x, s, c);
+        worst_s = std::max(worst_s, std::fabs(s - std::sin(static_cast<double>(x))));
+        worst_c = std::max(worst_c, std::fabs(c - std::cos(static_cast<double>(x))));
+    }
+    REQUIRE(worst_s <= 1.0e-7);
+    REQUIRE(worst_c <= 1.0e-7);
+}
+
+TEST_CASE("FastTrig: tan relative error bound over the steering range", "[fast_trig]") {
+    const double max_steer = Model::SteeringParams{}.max_steer_angle_rad;
+    REQUIRE(MaxTanRelError(max_steer, 1000000) <= 1.0e-7);
+    REQUIRE(MaxTanRelError(1.0, 1000000) <= 2.0e-7);
+    REQUIRE(Model::FastTrig::Tan(0.0f) == 0.0f);
+}
+
+TEST_CASE("StepBicycleBatchFast: every SIMD level is bit-identical", "[fast_trig][bicycle_batch]") {
+    constexpr std::size_t kVehicles = 37; // exercises the scalar tails of 4- and 8-lane kernels
+    const Model::BicycleParams p{};
+    std::vector<float> drive(kVehicles), brake(kVehicles), steer(kVehicles);
+    std::vector<uint8_t> estop(kVehicles);
+    const Model::BicycleBatchInput in{drive.data(), brake.data(), steer.data(), estop.data()};
+
+    const Model::SimdLevel levels[] = {Model::SimdLevel::Scalar, Model::SimdLevel::Sse2, Model::SimdLevel::Avx2};
+    std::vector<Model::BicycleBatch> batches(3, Model::BicycleBatch(kVehicles));
+    for (int k = 0; k < 1000; ++k) {
+        Commands(k, kVehicles, drive, brake, steer, estop);
+        for (std::size_t l = 0; l < 3; ++l) {
+            Model::StepBicycleBatchFast(batches[l], 0.01f, in, p, levels[l]);
+        }
+    }
+    for (std::size_t l = 1; l < 3; ++l) {
+        for (std::size_t i = 0; i < kVehicles; ++i) {
+            const auto a = batches[0].Get(i);
+            const auto b = batches[l].Get(i);
+            REQUIRE(SameBits(a.x, b.x));
+            REQUIRE(SameBits(a.y, b.y));
+            REQUIRE(SameBits(a.yaw, b.yaw));
+            REQUIRE(SameBits(a.v, b.v));
+            REQUIRE(SameBits(a.yaw_rate, b.yaw_rate));
+            REQUIRE(SameBits(a.wheel_omega, b.wheel_omega));
+        }
+    }
+}
+
+TEST_CASE("StepBicycleBatchFast: trajectory stays close to the libm kernel", "[fast_trig][bicycle_batch]") {
+    constexpr std::size_t kVehicles = 64;
+    const Model::BicycleParams p{};
+    std::vector<float> drive(kVehicles), brake(kVehicles), steer(kVehicles);
+    std::vector<uint8_t> estop(kVehicles);
+    const Model::BicycleBatchInput in{drive.data(), brake.data(), steer.data(), estop.data()};
+
+    Model::BicycleBatch ref(kVehicles);
+    Model::BicycleBatch fast(kVehicles);
+    for (int k = 0; k < 1000; ++k) {
+        Commands(k, kVehicles, drive, brake, steer, estop);
+        Model::StepBicycleBatch(ref, 0.01f, in, p);
+        Model::StepBicycleBatchFast(fast, 0.01f, in, p);
+    }
+    for (std::size_t i = 0; i < kVehicles; ++i) {
+        // Longitudinal path has no trig: identical
+        REQUIRE(SameBits(ref.v[i], fast.v[i]));
+        // 10 s of driving (~20 m): float rounding noise only
+        REQUIRE(std::fabs(ref.yaw[i] - fast.yaw[i]) < 1e-4f);
+        REQUIRE(std::fabs(ref.x[i] - fast.x[i]) < 1e-4f);
+        REQUIRE(std::fabs(ref.y[i] - fast.y[i]) < 1e-4f);
+    }
+}
@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "model/fixed_params.h"
+
+namespace {
+
+bool SameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; }
+
+// A non-default frozen set, to make sure nothing depends on the v1 values
+constexpr Model::BrakeParams kBrakeTuned{5.5f, 7.25f};
+constexpr Model::EngineParams kEngineTuned{1.75f};
+constexpr Model::VehicleParams kVehicleTuned{0.05f, 0.3f, 12.5f, 8.0f};
+
+// Compile-time evaluation of the variants
+static_assert(Model::ComputeBrakeDecel<Model::Fixed::kBrakeV1>(0.5f, false) == 2.0f);
+static_assert(Model::ComputeBrakeDecel<Model::Fixed::kBrakeV1>(0.5f, true) == 4.0f);
+static_assert(Model::ComputeDriveAccel<kEngineTuned>(2.0f, false) == 1.75f);
+static_assert(Model::ComputeDriveAccel<kEngineTuned>(1.0f, true) == 0.0f);
+static_assert(Model::StepLongitudinal<Model::Fixed::kVehicleV1>(Model::VehicleState{}, 0.5f, 2.0f, 0.0f, false).v == 1.0f);
+
+// Pedal inputs: in range, out of range, signed zeros, infinities and NaN
+std::vector<float> PedalInputs()
+{
+    std::vector<float> v{0.0f, -0.0f, 1.0f, -1.0f, 2.0f, 0.5f, 1e-30f, 1.0f - 1e-7f,
+                         std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                         std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min()};
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> u(-0.5f, 1.5f);
+    for (int i = 0; i < 100000; ++i) v.push_back(u(rng));
+    return v;
+}
+
+template <const Model::BrakeParams& P, const Model::EngineParams& E>
+void CheckActuators()
+{
+    for (const float x : PedalInputs()) {
+        for (const bool estop : {false, true}) {
+            REQUIRE(SameBits(Model::ComputeBrakeDecel<P>(x, estop), Model::ComputeBrakeDecel(x, estop, P)));
+            REQUIRE(SameBits(Model::ComputeDriveAccel<E>(x, estop), Model::ComputeDriveAccel(x, estop, E)));
+        }
+    }
+}
+
+template <const Model::VehicleParams& P>
+void CheckLongitudinal()
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> drive(0.0f, 3.0f);
+    std::uniform_real_distribution<float> brake(0.0f, 2.0f);
+    Model::VehicleState a{};
+    Model::VehicleState b{};
+    for (int k = 0; k < 100000; ++k) {
+        const float d = drive(rng);
+        const float br = (k % 500) < 100 ? brake(rng) : 0.0f;
+        const bool estop = (k % 5000) > 4900;
+        a = Model::StepLongitudinal<P>(a, 0.01f, d, br, estop);
+        b = Model::StepLongitudinal(b, 0.01f, d, br, estop, P);
+        REQUIRE(SameBits(a.v, b.v));
+        REQUIRE(SameBits(a.wheel_omega, b.wheel_omega));
+        REQUIRE(SameBits(a.t, b.t));
+    }
+}
+
+} // namespace
+
+TEST_CASE("FixedParams: brake/engine variants are bit-identical to the runtime versions", "[fixed_params]") {
+    CheckActuators<Model::Fixed::kBrakeV1, Model::Fixed::kEngineV1>();
+    CheckActuators<kBrakeTuned, kEngineTuned>();
+}
+
+TEST_CASE("FixedParams: StepLongitudinal variant is bit-identical over long runs", "[fixed_params]") {
+    CheckLongitudinal<Model::Fixed::kVehicleV1>();
+    CheckLongitudinal<kVehicleTuned>();
+}
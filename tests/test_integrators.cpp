@@ -0,0 +1,155 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstring>
+
+#include "model/bicycle_model.h"
+#include "model/integrators.h"
+#include "model/vehicledynamics_model.h"
+
+namespace {
+
+bool SameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; }
+
+// Smooth throttle/steer with a braking phase every minute; held per control period
+void Commands(double t, float& drive, float& brake, float& steer)
+{
+    drive = 0.3f + 0.4f * static_cast<float>(std::sin(t / 7.0));
+    brake = std::fmod(t, 60.0) > 50.0 ? 1.0f : 0.0f;
+    steer = 0.3f * static_cast<float>(std::sin(2.0 * M_PI * t / 20.0));
+}
+
+Model::BicycleState Drive(double seconds, float dt, const Model::IntegratorConfig& cfg)
+{
+    const Model::BicycleParams p{};
+    Model::BicycleState s{};
+    const long steps = std::lround(seconds / dt);
+    for (long k = 0; k < steps; ++k) {
+        float drive, brake, steer;
+        Commands(static_cast<double>(k) * dt, drive, brake, steer);
+        Model::StepBicycle(s, dt, drive, brake, steer, false, p, cfg);
+    }
+    return s;
+}
+
+Model::IntegratorConfig Config(Model::Integrator m, int substeps = 1)
+{
+    Model::IntegratorConfig c;
+    c.method = m;
+    c.substeps = substeps;
+    return c;
+}
+
+double PosError(const Model::BicycleState& a, const Model::BicycleState& b)
+{
+    return std::hypot(static_cast<double>(a.x) - b.x, static_cast<double>(a.y) - b.y);
+}
+
+} // namespace
+
+TEST_CASE("Integrators: default config is the v1 plant bit for bit", "[integrators]") {
+    const Model::BicycleParams p{};
+    Model::BicycleState a{};
+    Model::BicycleState b{};
+    for (int k = 0; k < 1000; ++k) {
+        float drive, brake, steer;
+        Commands(0.01 * k, drive, brake, steer);
+        Model::StepBicycle(a, 0.01f, drive, brake, steer, k > 900, p);
+        Model::StepBicycle(b, 0.01f, drive, brake, steer, k > 900, p, Model::IntegratorConfig{});
+    }
+    REQUIRE(SameBits(a.x, b.x));
+    REQUIRE(SameBits(a.y, b.y));
+    REQUIRE(SameBits(a.yaw, b.yaw));
+    REQUIRE(SameBits(a.v, b.v));
+
+    const Model::VehicleParams vp{};
+    Model::VehicleState la{};
+    Model::VehicleState lb{};
+    for (int k = 0; k < 500; ++k) {
+        la = Model::StepLongitudinal(la, 0.01f, 1.0f, 0.0f, false, vp);
+        lb = Model::StepLongitudinal(lb, 0.01f, 1.0f, 0.0f, false, vp, Model::IntegratorConfig{});
+    }
+    REQUIRE(SameBits(la.v, lb.v));
+    REQUIRE(SameBits(la.t, lb.t));
+}
+
+TEST_CASE("Integrators: trajectory error vs a fine reference at a 10x larger step", "[integrators]") {
+    // 10 minutes at a 100 ms plant step; the reference uses the same held
+    // commands but tight RK45, so only integration error is measured.
+    constexpr double kSeconds = 600.0;
+    constexpr float kDt = 0.1f;
+    Model::IntegratorConfig ref = Config(Model::Integrator::Rk45);
+    ref.rtol = 1e-11;
+    ref.atol = 1e-11;
+    const auto reference = Drive(kSeconds, kDt, ref);
+
+    const double euler = PosError(Drive(kSeconds, kDt, Config(Model::Integrator::SemiImplicitEuler)), reference);
+    const double rk4 = PosError(Drive(kSeconds, kDt, Config(Model::Integrator::Rk4, 4)), reference);
+    const double rk45 = PosError(Drive(kSeconds, kDt, Config(Model::Integrator::Rk45)), reference);
+
+    REQUIRE(euler > 1.0);   // ~35 m: why long sweeps could not raise the step before
+    REQUIRE(rk4 < 1e-2);    // ~2e-3 m
+    REQUIRE(rk45 < 1e-4);   // ~4e-6 m
+}
+
+TEST_CASE("Integrators: sub-stepping converges and speed stays within bounds", "[integrators]") {
+    const Model::BicycleParams p{};
+    double last_error = 1e9;
+    Model::IntegratorConfig ref = Config(Model::Integrator::Rk45);
+    ref.rtol = 1e-11;
+    ref.atol = 1e-11;
+    const auto reference = Drive(60.0, 0.1f, ref);
+    for (const int n : {1, 2, 4, 8}) {
+        const double e = PosError(Drive(60.0, 0.1f, Config(Model::Integrator::SemiImplicitEuler, n)), reference);
+        REQUIRE(e < last_error);
+        last_error = e;
+    }
+
+    // Full throttle would exceed max_speed_mps; full brake would go negative
+    for (const auto m : {Model::Integrator::Rk4, Model::Integrator::Rk45}) {
+        Model::BicycleState s{};
+        for (int k = 0; k < 50; ++k) Model::StepBicycle(s, 0.5f, 5.0f, 0.0f, 0.1f, false, p, Config(m));
+        REQUIRE(s.v == p.max_speed_mps);
+        for (int k = 0; k < 50; ++k) Model::StepBicycle(s, 0.5f, 0.0f, 5.0f, 0.1f, false, p, Config(m));
+        REQUIRE(s.v == 0.0f);
+    }
+}
+
+TEST_CASE("Integrators: RK45 returns within max_steps when the tolerance is unreachable", "[integrators]") {
+    Model::IntegratorConfig cfg = Config(Model::Integrator::Rk45);
+    cfg.rtol = 1e-30;
+    cfg.atol = 1e-30;
+    cfg.max_steps = 20;
+    Model::Ode::State<1> y{1.0};
+    int evals = 0;
+    const int accepted = Model::Ode::IntegrateRk45(
+        y, 1.0, cfg,
+        [&](const Model::Ode::State<1>& s) {
+            ++evals;
+            return s;
+        },
+        [](Model::Ode::State<1>&) {});
+    // 7 right-hand side evaluations per attempt; the forced step reaches t = dt
+    REQUIRE(evals <= 7 * cfg.max_steps);
+    REQUIRE(accepted >= 1);
+    REQUIRE(accepted <= cfg.max_steps);
+    REQUIRE(std::fabs(y[0] - std::exp(1.0)) < 1e-3);
+}
+
+TEST_CASE("Integrators: longitudinal RK4 matches the closed form", "[integrators]") {
+    // v' = a - drag * v  =>  v(t) = a/drag + (v0 - a/drag) * exp(-drag t), below max speed
+    Model::VehicleParams p{};
+    p.linear_drag = 0.5f;
+    p.max_speed_mps = 10.0f;
+    Model::VehicleState s{};
+    for (int k = 0; k < 20; ++k) {
+        s = Model::StepLongitudinal(s, 0.5f, 1.0f, 0.0f, false, p, Config(Model::Integrator::Rk4));
+    }
+    const double exact = 2.0 * (1.0 - std::exp(-0.5 * 10.0));
+    REQUIRE(std::fabs(s.v - exact) < 1e-5);
+    REQUIRE(std::fabs(s.t - 10.0f) < 1e-5f);
+
+    Model::Integrator m{};
+    REQUIRE(Model::ParseIntegrator("rk45", m));
+    REQUIRE(m == Model::Integrator::Rk45);
+    REQUIRE_FALSE(Model::ParseIntegrator("midpoint", m));
+}
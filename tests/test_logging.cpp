@@ -0,0 +1,565 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bsw/compressed_log.h"
+#include "bsw/logging.h"
+#include "rte/rte.h"
+
+namespace {
+
+std::string ReadFile(const std::filesystem::path& p)
+{
+    std::ifstream f(p, std::ios::binary);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
+
+// Step k of a deterministic RTE sequence, logged
+void LogStep(int k)
+{
+    Rte::VehicleState st{};
+    st.t = 0.01f * static_cast<float>(k);
+    st.x = 0.123456f * static_cast<float>(k);
+    st.yaw = -0.001f * static_cast<float>(k);
+    Rte::Rte_Write_VehicleState(st);
+    Rte::DriverInput in{};
+    in.throttle = (k % 7) / 7.0f;
+    Rte::Rte_Write_DriverInput(in);
+    Rte::Safety sf{};
+    sf.estop = (k % 50) == 0;
+    Rte::Rte_Write_Safety(sf);
+    Bsw::Logging::Tick10ms();
+}
+
+// Drives the RTE through the LogStep sequence and logs every step.
+void WriteLog(const std::filesystem::path& path, Bsw::Logging::Mode mode, int ticks,
+              Bsw::Logging::Format format = Bsw::Logging::Format::Csv)
+{
+    Rte::InitDefaults();
+    Bsw::Logging::Init(path.string(), mode, format);
+    for (int k = 0; k < ticks; ++k) LogStep(k);
+    Bsw::Logging::Shutdown();
+    Rte::InitDefaults();
+}
+
+} // namespace
+
+TEST_CASE("Logging: async mode writes the same bytes as sync mode", "[logging]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_logging";
+    constexpr int kTicks = 1000;
+
+    WriteLog(dir / "sync.csv", Bsw::Logging::Mode::Sync, kTicks);
+    REQUIRE(Bsw::Logging::GetStats().written == kTicks);
+
+    WriteLog(dir / "async.csv", Bsw::Logging::Mode::Async, kTicks);
+    // kTicks fits in the ring, so nothing can be dropped even if the writer stalls
+    const auto stats = Bsw::Logging::GetStats();
+    REQUIRE(stats.dropped == 0);
+    REQUIRE(stats.written == kTicks);
+
+    REQUIRE(ReadFile(dir / "sync.csv") == ReadFile(dir / "async.csv"));
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Logging: Init while a log is open finishes it first", "[logging]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_logging_reinit";
+    Rte::InitDefaults();
+    Bsw::Logging::Init((dir / "first.csv").string(), Bsw::Logging::Mode::Async);
+    for (int k = 0; k < 10; ++k) LogStep(k);
+    // No Shutdown: the running writer thread must be joined, not terminate the process
+    Bsw::Logging::Init((dir / "second.csv").string(), Bsw::Logging::Mode::Async);
+    for (int k = 0; k < 20; ++k) LogStep(k);
+    Bsw::Logging::Shutdown();
+    Rte::InitDefaults();
+
+    const std::string first = ReadFile(dir / "first.csv");
+    const std::string second = ReadFile(dir / "second.csv");
+    REQUIRE(std::count(first.begin(), first.end(), '\n') == 1 + 10);
+    REQUIRE(std::count(second.begin(), second.end(), '\n') == 1 + 20);
+    REQUIRE(second.compare(0, first.size(), first) == 0); // same header, same first ten records
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Logging: a full async ring drops records instead of blocking the 10ms task", "[logging]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_logging_drop";
+    constexpr int kRing = 4096; // async ring capacity (logging.cpp)
+    constexpr int kOver = 500;
+
+    Rte::InitDefaults();
+    Bsw::Logging::Init((dir / "held.csv").string(), Bsw::Logging::Mode::Async);
+    Bsw::Logging::HoldWriter(true);
+    auto worst = std::chrono::steady_clock::duration::zero();
+    for (int k = 0; k < kRing + kOver; ++k) {
+        Rte::VehicleState st{};
+        st.t = 0.01f * static_cast<float>(k);
+        Rte::Rte_Write_VehicleState(st);
+        const auto t0 = std::chrono::steady_clock::now();
+        Bsw::Logging::Tick10ms();
+        worst = std::max(worst, std::chrono::steady_clock::now() - t0);
+    }
+    // The writer never ran: exactly the overflow is dropped, and no tick waited for it
+    REQUIRE(Bsw::Logging::GetStats().dropped == kOver);
+    REQUIRE(Bsw::Logging::GetStats().written == 0);
+    REQUIRE(worst < std::chrono::milliseconds(50));
+
+    Bsw::Logging::Shutdown(); // releases the hold and drains what was queued
+    REQUIRE(Bsw::Logging::GetStats().written == kRing);
+    const std::string csv = ReadFile(dir / "held.csv");
+    REQUIRE(std::count(csv.begin(), csv.end(), '\n') == 1 + kRing);
+    REQUIRE(csv.find("\n40.950,") != std::string::npos); // last record that fit (k = 4095)
+    REQUIRE(csv.find("\n40.960,") == std::string::npos);
+    Rte::InitDefaults();
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Logging: columnar log converts back to the identical CSV", "[logging][columnar]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_columnar";
+    constexpr int kTicks = 10000;     // > 2 chunks, last one partial
+    constexpr int kAsyncTicks = 4000; // fits in the async ring
+
+    WriteLog(dir / "ref.csv", Bsw::Logging::Mode::Sync, kTicks);
+    WriteLog(dir / "sync.sdvlog", Bsw::Logging::Mode::Sync, kTicks, Bsw::Logging::Format::Columnar);
+    WriteLog(dir / "ref_async.csv", Bsw::Logging::Mode::Sync, kAsyncTicks);
+    WriteLog(dir / "async.sdvlog", Bsw::Logging::Mode::Async, kAsyncTicks, Bsw::Logging::Format::Columnar);
+    REQUIRE(Bsw::Logging::GetStats().dropped == 0);
+
+    std::string err;
+    REQUIRE(Bsw::Logging::ColumnarToCsv((dir / "sync.sdvlog").string(), (dir / "sync.csv").string(), err));
+    REQUIRE(Bsw::Logging::ColumnarToCsv((dir / "async.sdvlog").string(), (dir / "async.csv").string(), err));
+    REQUIRE(ReadFile(dir / "sync.csv") == ReadFile(dir / "ref.csv"));
+    REQUIRE(ReadFile(dir / "async.csv") == ReadFile(dir / "ref_async.csv"));
+    REQUIRE(std::filesystem::file_size(dir / "sync.sdvlog") < std::filesystem::file_size(dir / "ref.csv"));
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("ColumnarLog: reader exposes typed zero-copy column spans", "[logging][columnar]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_columnar_reader";
+    constexpr int kTicks = 5000;
+    WriteLog(dir / "log.sdvlog", Bsw::Logging::Mode::Sync, kTicks, Bsw::Logging::Format::Columnar);
+
+    Bsw::ColumnarLog::Reader reader;
+    std::string err;
+    REQUIRE(reader.Open((dir / "log.sdvlog").string(), err));
+    REQUIRE(reader.RowCount() == kTicks);
+    REQUIRE(reader.ColumnCount() == Bsw::Logging::RecordColumns().size());
+    REQUIRE(reader.ChunkCount() == 2);
+
+    const int x_col = reader.FindColumn("x");
+    const int estop_col = reader.FindColumn("estop");
+    REQUIRE(x_col >= 0);
+    REQUIRE(estop_col >= 0);
+    REQUIRE(reader.FindColumn("no_such_column") == -1);
+    // Wrong element type yields an empty span instead of reinterpreting bytes
+    REQUIRE(reader.ColumnSpan<uint8_t>(0, static_cast<std::size_t>(x_col)).size == 0);
+
+    std::size_t k = 0;
+    for (std::size_t c = 0; c < reader.ChunkCount(); ++c) {
+        const auto xs = reader.ColumnSpan<float>(c, static_cast<std::size_t>(x_col));
+        const auto es = reader.ColumnSpan<uint8_t>(c, static_cast<std::size_t>(estop_col));
+        REQUIRE(reinterpret_cast<std::uintptr_t>(xs.data) % alignof(float) == 0);
+        for (std::size_t i = 0; i < xs.size; ++i, ++k) {
+            REQUIRE(xs[i] == 0.123456f * static_cast<float>(k));
+            REQUIRE(es[i] == ((k % 50) == 0 ? 1 : 0));
+        }
+    }
+    REQUIRE(k == kTicks);
+
+    reader.Close();
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("ColumnarLog: truncated tail is ignored, garbage is rejected", "[logging][columnar]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_columnar_trunc";
+    WriteLog(dir / "log.sdvlog", Bsw::Logging::Mode::Sync, 5000, Bsw::Logging::Format::Columnar);
+    const auto size = std::filesystem::file_size(dir / "log.sdvlog");
+    std::filesystem::resize_file(dir / "log.sdvlog", size - 100);
+
+    Bsw::ColumnarLog::Reader reader;
+    std::string err;
+    REQUIRE(reader.Open((dir / "log.sdvlog").string(), err));
+    REQUIRE(reader.RowCount() == Bsw::ColumnarLog::kDefaultChunkRows);
+    reader.Close();
+
+    // The streaming reader stops at the truncated tail without an error...
+    Bsw::ColumnarLog::StreamReader stream;
+    REQUIRE(stream.Open((dir / "log.sdvlog").string(), err));
+    REQUIRE(stream.NextChunk());
+    REQUIRE_FALSE(stream.NextChunk());
+    REQUIRE(stream.Error().empty());
+    // ...and rejects a row count beyond the chunk capacity before sizing its buffer
+    {
+        std::fstream f(dir / "log.sdvlog", std::ios::binary | std::ios::in | std::ios::out);
+        const uint32_t rows = 0xffffffffu;
+        f.seekp(static_cast<std::streamoff>(sizeof(Bsw::ColumnarLog::FileHeader) +
+                                            stream.ColumnCount() * sizeof(Bsw::ColumnarLog::ColumnSchema) + 4));
+        f.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+    }
+    REQUIRE(stream.Open((dir / "log.sdvlog").string(), err));
+    REQUIRE_FALSE(stream.NextChunk());
+    REQUIRE_FALSE(stream.Error().empty());
+    stream.Close();
+
+    {
+        std::ofstream f(dir / "bad.sdvlog", std::ios::binary);
+        f << "t,throttle,brake,steer,and some more bytes\n";
+    }
+    REQUIRE_FALSE(reader.Open((dir / "bad.sdvlog").string(), err));
+    REQUIRE_FALSE(err.empty());
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Logging: compressed log converts back to the identical CSV", "[logging][compressed]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_compressed";
+    constexpr int kTicks = 10000;     // > 2 blocks, last one partial
+    constexpr int kAsyncTicks = 4000; // fits in the async ring
+
+    WriteLog(dir / "ref.csv", Bsw::Logging::Mode::Sync, kTicks);
+    WriteLog(dir / "ref.sdvlog", Bsw::Logging::Mode::Sync, kTicks, Bsw::Logging::Format::Columnar);
+    WriteLog(dir / "sync.sdvz", Bsw::Logging::Mode::Sync, kTicks, Bsw::Logging::Format::Compressed);
+    WriteLog(dir / "ref_async.csv", Bsw::Logging::Mode::Sync, kAsyncTicks);
+    WriteLog(dir / "async.sdvz", Bsw::Logging::Mode::Async, kAsyncTicks, Bsw::Logging::Format::Compressed);
+    REQUIRE(Bsw::Logging::GetStats().dropped == 0);
+
+    std::string err;
+    REQUIRE(Bsw::CompressedLog::IsCompressedLog((dir / "sync.sdvz").string()));
+    REQUIRE_FALSE(Bsw::CompressedLog::IsCompressedLog((dir / "ref.sdvlog").string()));
+    REQUIRE(Bsw::Logging::CompressedToCsv((dir / "sync.sdvz").string(), (dir / "sync.csv").string(), err));
+    REQUIRE(Bsw::Logging::CompressedToCsv((dir / "async.sdvz").string(), (dir / "async.csv").string(), err));
+    REQUIRE(ReadFile(dir / "sync.csv") == ReadFile(dir / "ref.csv"));
+    REQUIRE(ReadFile(dir / "async.csv") == ReadFile(dir / "ref_async.csv"));
+    REQUIRE(std::filesystem::file_size(dir / "sync.sdvz") * 20 < std::filesystem::file_size(dir / "ref.sdvlog"));
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Logging: sync compressed mode encodes blocks on the writer thread without loss", "[logging][compressed]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_compressed_sync";
+    constexpr int kTicks = 9000; // two full blocks and a partial one
+    WriteLog(dir / "ref.csv", Bsw::Logging::Mode::Sync, kTicks);
+
+    Rte::InitDefaults();
+    Bsw::Logging::Init((dir / "sync.sdvz").string(), Bsw::Logging::Mode::Sync, Bsw::Logging::Format::Compressed);
+    Bsw::Logging::HoldWriter(true);
+    int k = 0;
+    for (; k < 4096 + 50; ++k) LogStep(k);
+    REQUIRE(Bsw::Logging::GetStats().written == 0); // the full block waits for the writer thread
+    Bsw::Logging::HoldWriter(false);
+    for (; k < kTicks; ++k) LogStep(k); // the next handoff waits for it rather than dropping
+    Bsw::Logging::Shutdown();
+    Rte::InitDefaults();
+    REQUIRE(Bsw::Logging::GetStats().written == kTicks);
+    REQUIRE(Bsw::Logging::GetStats().dropped == 0);
+
+    std::string err;
+    REQUIRE(Bsw::Logging::CompressedToCsv((dir / "sync.sdvz").string(), (dir / "sync.csv").string(), err));
+    REQUIRE(ReadFile(dir / "sync.csv") == ReadFile(dir / "ref.csv"));
+    std::filesystem::remove_all(dir);
+}
+
+namespace {
+
+struct ZRow {
+    float ramp;   // smooth: second differences
+    float noise;  // bounded noise with rare outliers: bit-packed
+    float step;   // constant with one jump per block: runs
+    float wild;   // NaN/inf/huge in some blocks, -0 and tiny negatives: raw fallback and signs
+    uint8_t flag;
+};
+
+const std::vector<Bsw::CompressedLog::ColumnDesc>& ZColumns()
+{
+    using Bsw::CompressedLog::ColumnType;
+    static const std::vector<Bsw::CompressedLog::ColumnDesc> cols = {
+        {"ramp", ColumnType::F32, offsetof(ZRow, ramp), 3},
+        {"noise", ColumnType::F32, offsetof(ZRow, noise), 6},
+        {"step", ColumnType::F32, offsetof(ZRow, step), 0},
+        {"wild", ColumnType::F32, offsetof(ZRow, wild), 3},
+        {"flag", ColumnType::U8, offsetof(ZRow, flag), 0},
+    };
+    return cols;
+}
+
+ZRow MakeZRow(int k)
+{
+    ZRow r{};
+    r.ramp = 0.37f * static_cast<float>(k) + 1e-4f * static_cast<float>(k) * static_cast<float>(k);
+    const uint32_t h = static_cast<uint32_t>(k) * 2654435761u;
+    r.noise = static_cast<float>(h >> 24) * 1e-6f - ((k % 997) == 0 ? 50.0f : 0.0f);
+    r.step = (k % 300) < 150 ? 7.0f : -123456.0f;
+    const float wild[] = {-0.0f, -0.0004f, 0.0005f, -1.5f, 3e9f, 1e30f, NAN, INFINITY};
+    r.wild = (k / 256) % 2 == 0 ? wild[k % 4] : wild[k % 8];
+    r.flag = static_cast<uint8_t>((k / 10) % 3);
+    return r;
+}
+
+std::string PrintF(float v, int decimals)
+{
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%.*f", decimals, static_cast<double>(v));
+    return buf;
+}
+
+} // namespace
+
+TEST_CASE("CompressedLog: every codec reproduces the printed values", "[logging][compressed]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_compressed_codecs";
+    std::filesystem::create_directories(dir);
+    const auto path = (dir / "z.sdvz").string();
+    constexpr int kRows = 2000;
+    constexpr uint32_t kBlockRows = 256;
+    {
+        Bsw::CompressedLog::Writer w;
+        w.Open(std::fopen(path.c_str(), "wb"), ZColumns(), kBlockRows);
+        for (int k = 0; k < kRows; ++k) {
+            const ZRow r = MakeZRow(k);
+            w.Append(&r);
+        }
+    }
+
+    Bsw::CompressedLog::StreamReader reader;
+    std::string err;
+    REQUIRE(reader.Open(path, err));
+    REQUIRE(reader.ColumnCount() == ZColumns().size());
+    REQUIRE(reader.FindColumn("wild") == 3);
+    int k = 0;
+    bool saw_raw = false;
+    bool saw_coded_wild = false;
+    char buf[32];
+    while (reader.NextBlock()) {
+        for (std::size_t i = 0; i < reader.Rows(); ++i, ++k) {
+            const ZRow r = MakeZRow(k);
+            const float expect[] = {r.ramp, r.noise, r.step, r.wild};
+            for (std::size_t c = 0; c < 4; ++c) {
+                const int d = ZColumns()[c].decimals;
+                if (reader.IsRaw(c)) {
+                    const float raw = reader.RawValues(c)[i];
+                    REQUIRE(std::memcmp(&raw, &expect[c], sizeof(float)) == 0);
+                    continue;
+                }
+                const int len = Bsw::CompressedLog::FormatCode(reader.Codes(c)[i], static_cast<uint8_t>(d), buf);
+                REQUIRE(std::string(buf, static_cast<std::size_t>(len)) == PrintF(expect[c], d));
+                REQUIRE(reader.Values(c)[i] == std::strtof(PrintF(expect[c], d).c_str(), nullptr));
+            }
+            REQUIRE(reader.Codes(4)[i] == r.flag);
+        }
+        saw_raw = saw_raw || reader.IsRaw(3);
+        saw_coded_wild = saw_coded_wild || !reader.IsRaw(3);
+    }
+    REQUIRE(reader.Error().empty());
+    REQUIRE(k == kRows);
+    REQUIRE(saw_raw);
+    REQUIRE(saw_coded_wild);
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("CompressedLog: blocks decode alone, truncated tail and garbage", "[logging][compressed]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_compressed_trunc";
+    std::filesystem::create_directories(dir);
+    const auto path = dir / "z.sdvz";
+    {
+        Bsw::CompressedLog::Writer w;
+        w.Open(std::fopen(path.string().c_str(), "wb"), ZColumns(), 256);
+        for (int k = 0; k < 1000; ++k) {
+            const ZRow r = MakeZRow(k);
+            w.Append(&r);
+        }
+    }
+    const std::string bytes = ReadFile(path);
+
+    // Header + schema followed directly by the third block: decodes to rows 512..767
+    std::size_t blocks[5] = {};
+    std::size_t nblocks = 0;
+    for (std::size_t pos = bytes.find("ZBLK"); pos != std::string::npos && nblocks < 5;
+         pos = bytes.find("ZBLK", pos + 1)) {
+        blocks[nblocks++] = pos;
+    }
+    REQUIRE(nblocks == 4);
+    {
+        std::ofstream f(dir / "third.sdvz", std::ios::binary);
+        f << bytes.substr(0, blocks[0]) << bytes.substr(blocks[2], blocks[3] - blocks[2]);
+    }
+    Bsw::CompressedLog::StreamReader reader;
+    std::string err;
+    REQUIRE(reader.Open((dir / "third.sdvz").string(), err));
+    REQUIRE(reader.NextBlock());
+    REQUIRE(reader.Rows() == 256);
+    REQUIRE(reader.Values(0)[0] == std::strtof(PrintF(MakeZRow(512).ramp, 3).c_str(), nullptr));
+    REQUIRE_FALSE(reader.NextBlock());
+
+    // A crash mid-block leaves every complete block readable
+    std::filesystem::resize_file(path, blocks[3] + 20);
+    REQUIRE(reader.Open(path.string(), err));
+    std::size_t rows = 0;
+    while (reader.NextBlock()) rows += reader.Rows();
+    REQUIRE(rows == 768);
+
+    // A damaged stream is reported, not decoded
+    {
+        std::string bad = bytes;
+        bad[blocks[1] + sizeof(Bsw::CompressedLog::BlockHeader) + 1] ^= 0x55;
+        std::ofstream f(dir / "bad_stream.sdvz", std::ios::binary);
+        f << bad;
+    }
+    REQUIRE(reader.Open((dir / "bad_stream.sdvz").string(), err));
+    REQUIRE(reader.NextBlock());
+    REQUIRE_FALSE(reader.NextBlock());
+    REQUIRE_FALSE(reader.Error().empty());
+
+    {
+        std::ofstream f(dir / "bad.sdvz", std::ios::binary);
+        f << "t,throttle,brake,steer,and some more bytes\n";
+    }
+    REQUIRE_FALSE(reader.Open((dir / "bad.sdvz").string(), err));
+    REQUIRE_FALSE(err.empty());
+    reader.Close();
+    std::filesystem::remove_all(dir);
+}
+
+namespace {
+
+// 60 s at 10ms with E-Stop held over [20 s, 21 s) and Degraded at 45 s
+void DriveFlightRecorder(int ticks)
+{
+    Rte::InitDefaults();
+    for (int k = 0; k < ticks; ++k) {
+        Rte::VehicleState st{};
+        st.t = 0.01f * static_cast<float>(k);
+        st.v = (k % 300) / 100.0f;
+        Rte::Rte_Write_VehicleState(st);
+        Rte::Safety sf{};
+        sf.estop = k >= 2000 && k < 2100;
+        sf.system_state = sf.estop ? Rte::SystemState::EStop
+                                   : (k >= 4500 ? Rte::SystemState::Degraded : Rte::SystemState::Normal);
+        Rte::Rte_Write_Safety(sf);
+        Bsw::Logging::Tick10ms();
+    }
+    Bsw::Logging::Shutdown();
+    Rte::InitDefaults();
+}
+
+std::vector<std::string> Lines(const std::filesystem::path& p)
+{
+    std::ifstream f(p);
+    std::vector<std::string> out;
+    for (std::string line; std::getline(f, line);) out.push_back(line);
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("Logging: flight recorder writes pre/post windows around triggers only", "[logging][flight]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_flight_recorder";
+    std::filesystem::remove_all(dir);
+    const std::string path = (dir / "fr.csv").string();
+
+    Bsw::Logging::FlightRecorderConfig cfg;
+    cfg.pre_s = 2.0;
+    cfg.post_s = 1.0;
+    Bsw::Logging::InitFlightRecorder(path, cfg);
+    DriveFlightRecorder(6000);
+
+    // estop at 20 s (EStop state in the same sample: one window), Degraded at 45 s
+    REQUIRE(Bsw::Logging::GetStats().dumps == 2);
+    REQUIRE_FALSE(std::filesystem::exists(path));
+    const auto first = Lines(Bsw::Logging::FlightRecorderDumpPath(path, 0));
+    REQUIRE(first.size() == 1 + 300);
+    REQUIRE(first[1].rfind("18.010,", 0) == 0);  // 200 samples up to and including the trigger
+    REQUIRE(first[200].rfind("20.000,", 0) == 0);
+    REQUIRE(first.back().rfind("21.000,", 0) == 0);
+    const auto second = Lines(Bsw::Logging::FlightRecorderDumpPath(path, 1));
+    REQUIRE(second[200].rfind("45.000,", 0) == 0);
+    REQUIRE_FALSE(std::filesystem::exists(Bsw::Logging::FlightRecorderDumpPath(path, 2)));
+
+    // Every dumped row is byte-identical to the full log
+    const std::string full = (dir / "full.csv").string();
+    Bsw::Logging::Init(full);
+    DriveFlightRecorder(6000);
+    const auto all = Lines(full);
+    REQUIRE(std::equal(first.begin() + 1, first.end(), all.begin() + 1 + 1801));
+}
+
+TEST_CASE("Logging: flight recorder predicate, manual trigger and columnar dumps", "[logging][flight]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_flight_recorder_pred";
+    std::filesystem::remove_all(dir);
+    const std::string path = (dir / "fr.sdvlog").string();
+
+    Bsw::Logging::FlightRecorderConfig cfg;
+    cfg.pre_s = 0.5;
+    cfg.post_s = 0.5;
+    cfg.on_estop = false;
+    cfg.on_fault_state = false;
+    cfg.predicate = [](const Bsw::Logging::Record& r) { return r.v > 2.985f; }; // once every 3 s
+    Bsw::Logging::InitFlightRecorder(path, cfg, Bsw::Logging::Format::Columnar);
+    DriveFlightRecorder(1000);
+    REQUIRE(Bsw::Logging::GetStats().dumps == 3); // t = 2.99, 5.99, 8.99
+
+    std::string err;
+    const std::string csv = (dir / "000.csv").string();
+    REQUIRE(Bsw::Logging::ColumnarToCsv(Bsw::Logging::FlightRecorderDumpPath(path, 0), csv, err));
+    const auto rows = Lines(csv);
+    REQUIRE(rows.size() == 1 + 100);
+    REQUIRE(rows[50].rfind("2.990,", 0) == 0);
+    REQUIRE(Lines(Bsw::Logging::FlightRecorderDumpPath(path, 2)).size() > 0);
+
+    Bsw::Logging::InitFlightRecorder((dir / "manual.csv").string(), cfg);
+    Bsw::Logging::TriggerFlightRecorder();
+    DriveFlightRecorder(1);
+    REQUIRE(Bsw::Logging::GetStats().dumps == 1);
+    REQUIRE(Lines(Bsw::Logging::FlightRecorderDumpPath((dir / "manual.csv").string(), 0)).size() == 2);
+}
+
+TEST_CASE("Logging: a failed flight recorder dump closes its window and is counted", "[logging][flight]") {
+    // A regular file as the parent directory: not writable even for root
+    const auto blocker = std::filesystem::temp_directory_path() / "sdv_flight_recorder_blocker";
+    std::filesystem::remove_all(blocker);
+    std::ofstream(blocker) << "not a directory\n";
+    const std::string path = (blocker / "fr.csv").string();
+
+    Bsw::Logging::FlightRecorderConfig cfg;
+    cfg.pre_s = 2.0;
+    cfg.post_s = 1.0;
+    Bsw::Logging::InitFlightRecorder(path, cfg);
+    DriveFlightRecorder(6000);
+
+    // Both windows (20 s and 45 s) were attempted: the first failure did not leave a window open
+    REQUIRE(Bsw::Logging::GetStats().dumps == 0);
+    REQUIRE(Bsw::Logging::GetStats().dump_failures == 2);
+    REQUIRE(Bsw::Logging::GetStats().written == 0);
+    std::filesystem::remove_all(blocker);
+}
+
+TEST_CASE("Logging: flight recorder dumps are written by the writer thread", "[logging][flight]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_flight_recorder_held";
+    std::filesystem::remove_all(dir);
+    const std::string path = (dir / "fr.csv").string();
+
+    Bsw::Logging::FlightRecorderConfig cfg;
+    cfg.pre_s = 0.5;
+    cfg.post_s = 0.5;
+    cfg.on_estop = false;
+    cfg.on_fault_state = false;
+    cfg.predicate = [](const Bsw::Logging::Record& r) { return r.v > 2.985f; }; // once every 3 s
+    Bsw::Logging::InitFlightRecorder(path, cfg);
+    // Six windows close while the writer is stalled: the queued ones are written
+    // at Shutdown, the ones that found every slot taken are lost and counted
+    Bsw::Logging::HoldWriter(true);
+    DriveFlightRecorder(2000);
+    const auto s = Bsw::Logging::GetStats();
+    REQUIRE(s.dumps == 4);
+    REQUIRE(s.dump_failures == 2);
+    for (unsigned n = 0; n < 4; ++n) REQUIRE(Lines(Bsw::Logging::FlightRecorderDumpPath(path, n)).size() == 1 + 100);
+    REQUIRE_FALSE(std::filesystem::exists(Bsw::Logging::FlightRecorderDumpPath(path, 4)));
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,50 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+#include "bsw/profiler.h"
+#include "bsw/timebase.h"
+
+TEST_CASE("LatencyHistogram: quantiles stay within one sub-bucket", "[profiler]") {
+    Bsw::TimeBase::LatencyHistogram h;
+    for (int64_t v = 1; v <= 10000; ++v) h.Record(v);
+
+    REQUIRE(h.Count() == 10000);
+    REQUIRE(h.MinNs() == 1);
+    REQUIRE(h.MaxNs() == 10000);
+    REQUIRE(h.MeanNs() == 5000.5);
+
+    const auto p50 = h.QuantileNs(0.5);
+    REQUIRE(p50 >= 5000);
+    REQUIRE(p50 <= 5000 + 5000 / 8 + 1); // <= 12.5% relative error
+    REQUIRE(h.QuantileNs(1.0) == 10000);
+}
+
+TEST_CASE("LatencyHistogram: small and huge values", "[profiler]") {
+    Bsw::TimeBase::LatencyHistogram h;
+    h.Record(-5); // clock hiccup counts as zero
+    h.Record(0);
+    h.Record(7);
+    h.Record(int64_t{1} << 40);
+    REQUIRE(h.Count() == 4);
+    REQUIRE(h.MinNs() == 0);
+    REQUIRE(h.QuantileNs(0.5) == 0);
+    REQUIRE(h.MaxNs() == (uint64_t{1} << 40));
+}
+
+#if SDV_ENABLE_PROFILING
+TEST_CASE("Scheduler: per-runnable profile counts activations", "[profiler]") {
+    Bsw::TimeBase::Scheduler sched;
+    sched.AddTask10ms([] {}, "a");
+    sched.AddTask20ms([] {}, "b");
+    sched.AddTask100ms([] {}, "c");
+    sched.RunForSeconds(1.0);
+
+    const auto prof = sched.Profile();
+    REQUIRE(prof.size() == 6);
+    REQUIRE(std::string(prof[0].name) == "a");
+    REQUIRE(prof[0].hist.Count() == 100);
+    REQUIRE(prof[1].hist.Count() == 50);
+    REQUIRE(prof[2].hist.Count() == 10);
+    REQUIRE(prof[3].hist.Count() == 100); // [10ms total]
+}
+#endif
@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "app/ecu.h"
+#include "app/replay.h"
+#include "bsw/columnar_log.h"
+#include "bsw/logging.h"
+#include "rte/rte.h"
+
+namespace {
+
+std::string ReadFile(const std::filesystem::path& p)
+{
+    std::ifstream f(p, std::ios::binary);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
+
+// Full ECU run logged to path; replays from replay_path when given
+void RunLogged(const std::filesystem::path& path, Bsw::Logging::Format format,
+               const std::filesystem::path& replay_path = {})
+{
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    App::ReplaySource replay(256);
+    if (!replay_path.empty()) {
+        std::string err;
+        REQUIRE(replay.Open(replay_path.string(), err));
+        Swc::DriverInput::SetSource(ctx, &replay);
+    }
+    Bsw::Logging::Init(path.string(), Bsw::Logging::Mode::Sync, format);
+    App::StaticScheduler::RunForSeconds(10.0, ctx);
+    Bsw::Logging::Shutdown();
+}
+
+} // namespace
+
+TEST_CASE("Replay: replaying a recorded run reproduces its log", "[replay]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_replay";
+    std::filesystem::create_directories(dir);
+
+    RunLogged(dir / "rec.csv", Bsw::Logging::Format::Csv);
+    RunLogged(dir / "rec.sdvlog", Bsw::Logging::Format::Columnar);
+    RunLogged(dir / "rec.sdvz", Bsw::Logging::Format::Compressed);
+
+    SECTION("from CSV") {
+        RunLogged(dir / "replay.csv", Bsw::Logging::Format::Csv, dir / "rec.csv");
+        REQUIRE(ReadFile(dir / "replay.csv") == ReadFile(dir / "rec.csv"));
+    }
+    SECTION("from columnar") {
+        RunLogged(dir / "replay.csv", Bsw::Logging::Format::Csv, dir / "rec.sdvlog");
+        REQUIRE(ReadFile(dir / "replay.csv") == ReadFile(dir / "rec.csv"));
+    }
+    SECTION("from compressed") {
+        RunLogged(dir / "replay.csv", Bsw::Logging::Format::Csv, dir / "rec.sdvz");
+        REQUIRE(ReadFile(dir / "replay.csv") == ReadFile(dir / "rec.csv"));
+    }
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Replay: long recordings stream through a fixed prefetch ring", "[replay]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_replay_long";
+    std::filesystem::create_directories(dir);
+    const auto path = dir / "long.sdvlog";
+    constexpr int kRows = 300000; // ~50 min at 10ms
+
+    {
+        Bsw::ColumnarLog::Writer w;
+        w.Open(std::fopen(path.string().c_str(), "wb"), Bsw::Logging::RecordColumns());
+        for (int k = 0; k < kRows; ++k) {
+            Bsw::Logging::Record r{};
+            r.t = 0.01f * static_cast<float>(k + 1);
+            r.throttle = static_cast<float>(k % 100) / 100.0f;
+            r.steer = -static_cast<float>(k % 7) / 7.0f;
+            w.Append(&r);
+        }
+    }
+
+    App::ReplaySource replay(64);
+    REQUIRE(replay.PrefetchCapacity() == 64);
+    std::string err;
+    REQUIRE(replay.Open(path.string(), err));
+
+    Rte::DriverInput in{};
+    for (int k = 0; k < kRows; ++k) {
+        // The sample at t_k is the one recorded for the step ending at t_{k+1}
+        REQUIRE(replay.Sample(0.01f * static_cast<float>(k), in));
+        if (in.throttle != static_cast<float>(k % 100) / 100.0f) FAIL("throttle mismatch at row " << k);
+        if (in.steer != -static_cast<float>(k % 7) / 7.0f) FAIL("steer mismatch at row " << k);
+    }
+    REQUIRE(replay.SamplesConsumed() == kRows);
+    REQUIRE_FALSE(replay.Sample(0.01f * static_cast<float>(kRows), in));
+
+    replay.Close();
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Replay: exhausted source releases the driver inputs", "[replay]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_replay_end";
+    std::filesystem::create_directories(dir);
+    {
+        std::ofstream f(dir / "short.csv");
+        f << "t,throttle,brake,steer\n0.010,0.5,0.1,0.3\n0.020,0.5,0.1,0.3\n";
+    }
+
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    App::ReplaySource replay;
+    std::string err;
+    REQUIRE(replay.Open((dir / "short.csv").string(), err));
+    Swc::DriverInput::SetSource(ctx, &replay);
+
+    Swc::DriverInput::Main20ms(ctx, App::kDt20ms);
+    REQUIRE(Rte::Rte_Read_DriverInput(ctx).throttle == 0.5f);
+
+    Rte::VehicleState st{};
+    st.t = 1.0f;
+    Rte::Rte_Write_VehicleState(ctx, st);
+    Swc::DriverInput::Main20ms(ctx, App::kDt20ms);
+    const auto in = Rte::Rte_Read_DriverInput(ctx);
+    REQUIRE(in.throttle == 0.0f);
+    REQUIRE(in.brake == 0.0f);
+    REQUIRE(in.steer == 0.0f);
+
+    App::ReplaySource missing;
+    REQUIRE_FALSE(missing.Open((dir / "nope.csv").string(), err));
+    std::filesystem::remove_all(dir);
+}
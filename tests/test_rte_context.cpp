@@ -0,0 +1,61 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "app/ecu.h"
+#include "rte/rte.h"
+
+namespace {
+
+bool SameState(const Rte::VehicleState& a, const Rte::VehicleState& b)
+{
+    return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+} // namespace
+
+TEST_CASE("RteContext: default facade and explicit instances are independent", "[rte_context]") {
+    Rte::InitDefaults();
+    Rte::Context other;
+    Rte::InitDefaults(other);
+
+    Rte::DriverInput in{};
+    in.throttle = 0.7f;
+    Rte::Rte_Write_DriverInput(in);
+
+    REQUIRE(Rte::Rte_Read_DriverInput().throttle == 0.7f);
+    REQUIRE(Rte::Rte_Read_DriverInput(Rte::DefaultContext()).throttle == 0.7f);
+    REQUIRE(Rte::Rte_Read_DriverInput(other).throttle == 0.0f);
+    Rte::InitDefaults();
+}
+
+TEST_CASE("RteContext: parallel simulations match a single default-instance run", "[rte_context]") {
+    // Reference: default instance + runtime scheduler (same path as sdv_sim)
+    Rte::Context& ref = Rte::DefaultContext();
+    App::InitEcu(ref);
+    {
+        Bsw::TimeBase::Scheduler sched;
+        App::RegisterTasks(sched, ref);
+        sched.RunForSeconds(10.0);
+    }
+
+    constexpr int kInstances = 4;
+    std::vector<Rte::Context> ctxs(kInstances);
+    std::vector<std::thread> workers;
+    for (auto& ctx : ctxs) {
+        workers.emplace_back([&ctx] {
+            App::InitEcu(ctx);
+            App::StaticScheduler::RunForSeconds(10.0, ctx);
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    for (const auto& ctx : ctxs) {
+        REQUIRE(SameState(Rte::Rte_Read_VehicleState(ctx), Rte::Rte_Read_VehicleState(ref)));
+        REQUIRE(ctx.steering.steer_angle == ref.steering.steer_angle);
+        REQUIRE(ctx.diag.heartbeat == ref.diag.heartbeat);
+    }
+    REQUIRE(ref.diag.heartbeat == 100);
+    Rte::InitDefaults();
+}
@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "rte/rte.h"
+#include "rte/rte_port.h"
+
+namespace {
+
+// Every Write stores k into all fields, so a torn read shows mixed values
+Rte::VehicleState Uniform(float k) { return Rte::VehicleState{k, k, k, k, k, k, k}; }
+
+bool IsUniform(const Rte::VehicleState& s)
+{
+    return s.x == s.t && s.y == s.t && s.yaw == s.t && s.v == s.t && s.yaw_rate == s.t &&
+           s.wheel_omega == s.t;
+}
+
+} // namespace
+
+TEST_CASE("SeqlockPort: Read returns the last Write", "[rte_port]") {
+    Rte::SeqlockPort<Rte::VehicleState> port;
+    REQUIRE(IsUniform(port.Read()));
+    REQUIRE(port.Read().t == 0.0f);
+
+    port.Write(Uniform(3.0f));
+    REQUIRE(port.Read().v == 3.0f);
+
+    Rte::SeqlockPort<Rte::VehicleState> copy = port;
+    port.Write(Uniform(4.0f));
+    REQUIRE(copy.Read().v == 3.0f);
+    copy = port;
+    REQUIRE(copy.Read().v == 4.0f);
+
+    static_assert(alignof(Rte::SeqlockPort<float>) == Rte::kCacheLineSize);
+}
+
+TEST_CASE("SeqlockPort: concurrent readers never observe a torn snapshot", "[rte_port]") {
+    Rte::SeqlockPort<Rte::VehicleState> port;
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::atomic<int> backwards{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            float last = 0.0f;
+            while (!done.load(std::memory_order_acquire)) {
+                const auto s = port.Read();
+                if (!IsUniform(s)) torn.fetch_add(1);
+                if (s.t < last) backwards.fetch_add(1);
+                last = s.t;
+            }
+        });
+    }
+
+    for (int k = 1; k <= 200000; ++k) {
+        port.Write(Uniform(static_cast<float>(k)));
+        if ((k & 0x3ff) == 0) std::this_thread::yield(); // let readers interleave on few cores
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& t : readers) t.join();
+
+    REQUIRE(torn.load() == 0);
+    REQUIRE(backwards.load() == 0);
+    REQUIRE(port.Read().t == 200000.0f);
+}
+
+TEST_CASE("Rte ports: ActuatorCmd element writes compose into one read", "[rte_port]") {
+    Rte::Context ctx;
+    Rte::Rte_Write_ActuatorCmd_DriveAccelCmd(ctx, 1.0f);
+    Rte::Rte_Write_ActuatorCmd_BrakeDecelCmd(ctx, 2.0f);
+    Rte::Rte_Write_ActuatorCmd_SteerAngleCmd(ctx, 0.1f);
+
+    const auto cmd = Rte::Rte_Read_ActuatorCmd(ctx);
+    REQUIRE(cmd.drive_accel_cmd == 1.0f);
+    REQUIRE(cmd.brake_decel_cmd == 2.0f);
+    REQUIRE(cmd.steer_angle_cmd == 0.1f);
+
+    Rte::InitDefaults(ctx);
+    REQUIRE(Rte::Rte_Read_ActuatorCmd(ctx).brake_decel_cmd == 0.0f);
+}
+
+TEST_CASE("Rte ports: sequence numbers count writes for both backends", "[rte_port]") {
+    Rte::PlainPort<float> plain;
+    Rte::SeqlockPort<float> seqlock;
+    const uint32_t p0 = plain.Seq();
+    const uint32_t s0 = seqlock.Seq();
+
+    for (int i = 0; i < 3; ++i) {
+        plain.Write(1.0f); // same value still counts as an update
+        seqlock.Write(1.0f);
+    }
+    REQUIRE(plain.Seq() == p0 + 3);
+    REQUIRE(seqlock.Seq() == s0 + 3);
+
+    // Assignment (context reset, snapshot restore) is an update too
+    const Rte::PlainPort<float> other;
+    plain = other;
+    REQUIRE(plain.Seq() == p0 + 4);
+    REQUIRE(plain.Read() == 0.0f);
+
+    Rte::Context ctx;
+    const uint32_t di = Rte::Rte_Seq_DriverInput(ctx);
+    const uint32_t sf = Rte::Rte_Seq_Safety(ctx);
+    Rte::Rte_Write_DriverInput(ctx, Rte::DriverInput{});
+    REQUIRE(Rte::Rte_Seq_DriverInput(ctx) == di + 1);
+    REQUIRE(Rte::Rte_Seq_Safety(ctx) == sf);
+    Rte::InitDefaults(ctx);
+    REQUIRE(Rte::Rte_Seq_DriverInput(ctx) != di + 1);
+}
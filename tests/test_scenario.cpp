@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "app/ecu.h"
+#include "app/scenario.h"
+#include "bsw/logging.h"
+#include "rte/rte.h"
+
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+std::string ReadFile(const std::filesystem::path& p)
+{
+    std::ifstream f(p, std::ios::binary);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
+
+void RunLogged(const std::filesystem::path& path, Swc::DriverInput::InputSource* source)
+{
+    Rte::Context ctx;
+    App::InitEcu(ctx);
+    Swc::DriverInput::SetSource(ctx, source);
+    Bsw::Logging::Init(path.string());
+    App::StaticScheduler::RunForSeconds(10.0, ctx);
+    Bsw::Logging::Shutdown();
+}
+
+// n back-to-back 0.5s segments; even ones hold, odd ones ramp
+std::string MakeTable(int n)
+{
+    std::ostringstream os;
+    for (int i = 0; i < n; ++i) {
+        os << 0.5 * i << ' ' << 0.5 * (i + 1) << ' ';
+        if (i % 2 == 0) {
+            os << (i % 10) / 10.0 << " 0 0\n";
+        } else {
+            os << "0:1 0 -1:1\n";
+        }
+    }
+    return os.str();
+}
+
+} // namespace
+
+TEST_CASE("Scenario: v1 demo table reproduces the built-in scenario", "[scenario]") {
+    const auto dir = std::filesystem::temp_directory_path() / "sdv_test_scenario";
+    std::filesystem::create_directories(dir);
+
+    App::ScenarioSource table;
+    std::string err;
+    REQUIRE(table.LoadFile(SDV_SOURCE_DIR "/scenarios/v1_demo.scn", err));
+    REQUIRE(table.Size() == 4);
+
+    RunLogged(dir / "builtin.csv", nullptr);
+    RunLogged(dir / "table.csv", &table);
+    REQUIRE(ReadFile(dir / "table.csv") == ReadFile(dir / "builtin.csv"));
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Scenario: ramps interpolate, gaps release, end exhausts", "[scenario]") {
+    App::ScenarioSource s;
+    std::string err;
+    REQUIRE(s.LoadString("# unsorted on purpose\n"
+                         "4 6  0  0:1  0.5\n"
+                         "0 2  0:1 0  -0.2:0.2   # ramp\n", err));
+    REQUIRE(s.Size() == 2);
+    REQUIRE(s.EndTime() == 6.0f);
+
+    Rte::DriverInput in{};
+    REQUIRE(s.Sample(0.0f, in));
+    REQUIRE(in.throttle == 0.0f);
+    REQUIRE(in.steer == -0.2f);
+    REQUIRE(s.Sample(1.0f, in));
+    REQUIRE_THAT(in.throttle, WithinAbs(0.5, 1e-6));
+    REQUIRE_THAT(in.steer, WithinAbs(0.0, 1e-6));
+
+    in.throttle = 1.0f;
+    REQUIRE(s.Sample(3.0f, in)); // gap
+    REQUIRE(in.throttle == 0.0f);
+    REQUIRE(in.brake == 0.0f);
+    REQUIRE(s.Sample(5.0f, in));
+    REQUIRE_THAT(in.brake, WithinAbs(0.5, 1e-6));
+    REQUIRE(in.steer == 0.5f);
+
+    REQUIRE_FALSE(s.Sample(6.0f, in));
+    REQUIRE(s.Sample(1.0f, in)); // going back in time is allowed
+    REQUIRE_THAT(in.throttle, WithinAbs(0.5, 1e-6));
+}
+
+TEST_CASE("Scenario: malformed and overlapping tables are rejected", "[scenario]") {
+    App::ScenarioSource s;
+    std::string err;
+    REQUIRE_FALSE(s.LoadString("0 1 0.5 0\n", err));
+    REQUIRE(err.find("line 1") != std::string::npos);
+    REQUIRE_FALSE(s.LoadString("0 1 0.5 0 x\n", err));
+    REQUIRE_FALSE(s.LoadString("2 1 0 0 0\n", err));
+    REQUIRE_FALSE(s.LoadString("0 2 0 0 0\n1 3 0 0 0\n", err));
+    REQUIRE(err.find("overlapping") != std::string::npos);
+    REQUIRE_FALSE(s.LoadFile("/nonexistent/scenario.scn", err));
+}
+
+TEST_CASE("Scenario: cursor lookup agrees with binary search", "[scenario]") {
+    constexpr int kSegments = 5000;
+    App::ScenarioSource s;
+    std::string err;
+    REQUIRE(s.LoadString(MakeTable(kSegments), err));
+    REQUIRE(s.Size() == kSegments);
+
+    // Monotonic 10ms ticks (cursor path), then random jumps both ways (search path)
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> any(-1.0f, 0.5f * kSegments + 1.0f);
+    constexpr int kTicks = 50 * kSegments;
+    for (int k = 0; k < 2 * kTicks; ++k) {
+        const float t = k < kTicks ? 0.01f * static_cast<float>(k) : any(rng);
+        Rte::DriverInput in{};
+        // Before the first segment counts as a gap, only the end exhausts the source
+        if (s.Sample(t, in) != (t < s.EndTime())) FAIL("exhaustion mismatch at t=" << t);
+        if (t < 0.0f || t >= s.EndTime()) continue;
+
+        const auto seg = static_cast<int>(std::floor(t / 0.5f));
+        if (s.FindSegment(t) != static_cast<std::size_t>(seg)) FAIL("FindSegment mismatch at t=" << t);
+        const float dt = t - 0.5f * static_cast<float>(seg);
+        const float throttle = seg % 2 == 0 ? static_cast<float>(seg % 10) / 10.0f : 2.0f * dt;
+        const float steer = seg % 2 == 0 ? 0.0f : -1.0f + 4.0f * dt;
+        if (std::fabs(in.throttle - throttle) > 1e-5f || std::fabs(in.steer - steer) > 1e-5f) {
+            FAIL("value mismatch at t=" << t << " segment " << seg);
+        }
+    }
+    REQUIRE(s.FindSegment(-0.5f) == App::ScenarioSource::kNoSegment);
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "app/ecu.h"
+#include "app/snapshot.h"
+#include "app/sweep.h"
+
+namespace {
+
+bool SameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; }
+
+bool SameState(const Rte::VehicleState& a, const Rte::VehicleState& b)
+{
+    return SameBits(a.t, b.t) && SameBits(a.x, b.x) && SameBits(a.y, b.y) && SameBits(a.yaw, b.yaw) &&
+           SameBits(a.v, b.v) && SameBits(a.yaw_rate, b.yaw_rate) && SameBits(a.wheel_omega, b.wheel_omega);
+}
+
+bool SameSummary(const App::Sweep::Summary& a, const App::Sweep::Summary& b)
+{
+    return SameBits(a.max_speed_mps, b.max_speed_mps) && SameBits(a.distance_m, b.distance_m) &&
+           SameBits(a.stopping_distance_m, b.stopping_distance_m) &&
+           SameBits(a.stopping_time_s, b.stopping_time_s) && SameState(a.final_state, b.final_state);
+}
+
+} // namespace
+
+TEST_CASE("Snapshot: restore resumes bit-identically mid-hyperperiod", "[snapshot]") {
+    // Uninterrupted reference run
+    Rte::Context ref;
+    App::InitEcu(ref);
+    Bsw::TimeBase::Scheduler ref_sched;
+    App::RegisterTasks(ref_sched, ref);
+    ref_sched.RunForSeconds(10.0);
+
+    // 3.33 s is tick 333: odd, so the next tick skips the 20ms runnable
+    Rte::Context a;
+    App::InitEcu(a);
+    Bsw::TimeBase::Scheduler a_sched;
+    App::RegisterTasks(a_sched, a);
+    a_sched.RunForSeconds(3.33);
+    const auto blob = App::Snapshot::Save(a, a_sched.Tick());
+    REQUIRE(blob.size() == 248);
+
+    Rte::Context b;
+    App::InitEcu(b);
+    Bsw::TimeBase::Scheduler b_sched;
+    App::RegisterTasks(b_sched, b);
+    int64_t tick = 0;
+    std::string err;
+    REQUIRE(App::Snapshot::Restore(blob, b, tick, err));
+    REQUIRE(tick == 333);
+    b_sched.SetTick(tick);
+    b_sched.RunForSeconds(10.0 - 3.33);
+
+    REQUIRE(SameState(Rte::Rte_Read_VehicleState(b), Rte::Rte_Read_VehicleState(ref)));
+    REQUIRE(SameBits(b.steering.steer_angle, ref.steering.steer_angle));
+    REQUIRE(b.diag.heartbeat == ref.diag.heartbeat);
+    REQUIRE(Rte::Rte_Read_Safety(b).system_state == Rte::Rte_Read_Safety(ref).system_state);
+
+    // Saving the resumed run reproduces the reference blob byte for byte
+    REQUIRE(App::Snapshot::Save(b, b_sched.Tick()) == App::Snapshot::Save(ref, ref_sched.Tick()));
+}
+
+TEST_CASE("Snapshot: calibration is kept and malformed blobs are rejected", "[snapshot]") {
+    Rte::Context src;
+    App::InitEcu(src);
+    Rte::VehicleState st{};
+    st.t = 1.5f;
+    st.v = 2.0f;
+    Rte::Rte_Write_VehicleState(src, st);
+    const auto blob = App::Snapshot::Save(src, 150);
+
+    Rte::Context dst;
+    dst.calib.vehicle.max_speed_mps = 7.0f;
+    App::InitEcu(dst);
+    int64_t tick = 0;
+    std::string err;
+    REQUIRE(App::Snapshot::Restore(blob, dst, tick, err));
+    REQUIRE(dst.calib.vehicle.max_speed_mps == 7.0f);
+    REQUIRE(Rte::Rte_Read_VehicleState(dst).v == 2.0f);
+
+    Rte::Context untouched;
+    App::InitEcu(untouched);
+    auto truncated = blob;
+    truncated.pop_back();
+    REQUIRE_FALSE(App::Snapshot::Restore(truncated, untouched, tick, err));
+    auto foreign = blob;
+    foreign[0] = 'X';
+    REQUIRE_FALSE(App::Snapshot::Restore(foreign, untouched, tick, err));
+    auto future = blob;
+    future[8] = 3; // version
+    REQUIRE_FALSE(App::Snapshot::Restore(future, untouched, tick, err));
+    REQUIRE(err.find("version") != std::string::npos);
+    REQUIRE(Rte::Rte_Read_VehicleState(untouched).v == 0.0f);
+}
+
+TEST_CASE("Snapshot: sweep runs forked from a checkpoint match full runs", "[snapshot]") {
+    const Rte::Calibration base{};
+    const auto prefix = App::Sweep::RunPrefix(base, 4.0);
+
+    // Same calibration: forking must not change anything
+    REQUIRE(SameSummary(App::Sweep::RunScenario(base, 10.0, &prefix), App::Sweep::RunScenario(base, 10.0)));
+
+    // Variant diverging at the fork point (braking starts at 5 s)
+    Rte::Calibration variant = base;
+    variant.brake.max_decel_mps2 = 1.5f;
+    const auto forked = App::Sweep::RunScenario(variant, 10.0, &prefix);
+    REQUIRE_FALSE(SameSummary(forked, App::Sweep::RunScenario(base, 10.0)));
+    REQUIRE(SameSummary(forked, App::Sweep::RunScenario(variant, 10.0)));
+}
@@ -0,0 +1,61 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+#include "bsw/static_scheduler.h"
+#include "bsw/timebase.h"
+
+namespace {
+
+std::string g_trace;
+
+void A10() { g_trace += 'a'; }
+void B10() { g_trace += 'b'; }
+void C20() { g_trace += 'c'; }
+void D100() { g_trace += 'd'; }
+
+using Static = Bsw::TimeBase::StaticScheduler<
+    Bsw::TimeBase::TaskList<&A10, &B10>,
+    Bsw::TimeBase::TaskList<&C20>,
+    Bsw::TimeBase::TaskList<&D100>>;
+
+std::string RuntimeTrace(double seconds)
+{
+    g_trace.clear();
+    Bsw::TimeBase::Scheduler sched;
+    sched.AddTask10ms(A10);
+    sched.AddTask10ms(B10);
+    sched.AddTask20ms(C20);
+    sched.AddTask100ms(D100);
+    sched.RunForSeconds(seconds);
+    return g_trace;
+}
+
+std::string StaticTrace(double seconds)
+{
+    g_trace.clear();
+    Static::RunForSeconds(seconds);
+    return g_trace;
+}
+
+void Count(int& n) { ++n; }
+
+} // namespace
+
+TEST_CASE("StaticScheduler: same call order as runtime Scheduler", "[static_scheduler]") {
+    REQUIRE(StaticTrace(0.0) == RuntimeTrace(0.0));
+    REQUIRE(StaticTrace(0.01) == RuntimeTrace(0.01));
+    REQUIRE(StaticTrace(0.1) == RuntimeTrace(0.1));
+    REQUIRE(StaticTrace(1.23) == RuntimeTrace(1.23));   // partial hyperperiod at the end
+    REQUIRE(StaticTrace(10.0) == RuntimeTrace(10.0));
+}
+
+TEST_CASE("StaticScheduler: tasks receive the arguments passed to RunForSeconds", "[static_scheduler]") {
+    using Counting = Bsw::TimeBase::StaticScheduler<
+        Bsw::TimeBase::TaskList<&Count>,
+        Bsw::TimeBase::TaskList<>,
+        Bsw::TimeBase::TaskList<&Count>>;
+
+    int n = 0;
+    Counting::RunForSeconds(1.0, n);
+    REQUIRE(n == 100 + 10);
+}
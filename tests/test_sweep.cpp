@@ -0,0 +1,108 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+#include "app/sweep.h"
+#include "app/work_stealing_pool.h"
+
+TEST_CASE("WorkStealingPool: every index runs exactly once", "[sweep]") {
+    App::WorkStealingPool pool(4);
+    for (std::size_t n : {1u, 7u, 1000u}) {
+        std::vector<std::atomic<int>> hits(n);
+        pool.ParallelFor(n, [&](std::size_t i) { hits[i].fetch_add(1); });
+        for (auto& h : hits) REQUIRE(h.load() == 1);
+    }
+}
+
+TEST_CASE("Sweep: grid and random dimensions expand deterministically", "[sweep]") {
+    App::Sweep::Plan plan;
+    App::Sweep::Dimension d;
+    std::string err;
+    REQUIRE(App::Sweep::ParseDimension("brake.max_decel_mps2=2:6:3", App::Sweep::Dist::Grid, d, err));
+    plan.dims.push_back(d);
+    REQUIRE(App::Sweep::ParseDimension("engine.max_accel_mps2=1:3", App::Sweep::Dist::Uniform, d, err));
+    plan.dims.push_back(d);
+    plan.samples = 4;
+
+    REQUIRE(App::Sweep::RunCount(plan) == 12);
+    REQUIRE(App::Sweep::MakeCalibration(plan, 0).brake.max_decel_mps2 == 2.0f);
+    REQUIRE(App::Sweep::MakeCalibration(plan, 4).brake.max_decel_mps2 == 4.0f);
+    REQUIRE(App::Sweep::MakeCalibration(plan, 11).brake.max_decel_mps2 == 6.0f);
+
+    const auto a = App::Sweep::MakeCalibration(plan, 5);
+    const auto b = App::Sweep::MakeCalibration(plan, 5);
+    REQUIRE(a.engine.max_accel_mps2 == b.engine.max_accel_mps2);
+    REQUIRE(a.engine.max_accel_mps2 >= 1.0f);
+    REQUIRE(a.engine.max_accel_mps2 < 3.0f);
+
+    REQUIRE_FALSE(App::Sweep::ParseDimension("brake.nope=1:2:3", App::Sweep::Dist::Grid, d, err));
+    REQUIRE_FALSE(App::Sweep::ParseDimension("brake.max_decel_mps2=1:2", App::Sweep::Dist::Grid, d, err));
+}
+
+TEST_CASE("Sweep: parser rejects values the distributions cannot take", "[sweep]") {
+    using App::Sweep::Dist;
+    App::Sweep::Dimension d;
+    std::string err;
+    auto rejects = [&](const char* spec, Dist dist) {
+        err.clear();
+        return !App::Sweep::ParseDimension(spec, dist, d, err) && !err.empty();
+    };
+    REQUIRE(rejects("brake.max_decel_mps2=3:1", Dist::Uniform));        // lo > hi
+    REQUIRE(App::Sweep::ParseDimension("brake.max_decel_mps2=2:2", Dist::Uniform, d, err));
+    REQUIRE(rejects("brake.max_decel_mps2=4:0", Dist::Normal));         // stddev 0
+    REQUIRE(rejects("brake.max_decel_mps2=4:-1", Dist::Normal));
+    REQUIRE(rejects("brake.max_decel_mps2=2:6:2.7", Dist::Grid));       // fractional count
+    REQUIRE(rejects("brake.max_decel_mps2=2:6:1e30", Dist::Grid));      // would overflow size_t
+    REQUIRE(rejects("brake.max_decel_mps2=2:6:0", Dist::Grid));
+    REQUIRE(rejects("brake.max_decel_mps2=nan:6:3", Dist::Grid));
+    REQUIRE(rejects("brake.max_decel_mps2=1:inf", Dist::Uniform));
+    REQUIRE(App::Sweep::ParseDimension("brake.max_decel_mps2=2:6:5", Dist::Grid, d, err));
+    REQUIRE(d.count == 5);
+
+    // Bounds a calibration file could not set either
+    REQUIRE(rejects("vehicle.max_speed_mps=-5:1:3", Dist::Grid));
+    REQUIRE(err.find("outside") != std::string::npos);
+    REQUIRE(rejects("vehicle.max_speed_mps=0:10", Dist::Uniform));
+    REQUIRE(rejects("vehicle.max_speed_mps=5:200", Dist::Uniform));
+    REQUIRE(rejects("vehicle.max_speed_mps=-1:2", Dist::Normal));
+}
+
+TEST_CASE("Sweep: normal draws stay inside the parameter's range", "[sweep]") {
+    App::Sweep::Plan plan;
+    App::Sweep::Dimension d;
+    std::string err;
+    // Mean near the open lower bound: about half of the raw draws are <= 0
+    REQUIRE(App::Sweep::ParseDimension("vehicle.max_speed_mps=0.5:4", App::Sweep::Dist::Normal, d, err));
+    plan.dims.push_back(d);
+    plan.samples = 200;
+    for (std::size_t i = 0; i < App::Sweep::RunCount(plan); ++i) {
+        REQUIRE(d.param->range.Contains(App::Sweep::MakeCalibration(plan, i).vehicle.max_speed_mps));
+    }
+}
+
+TEST_CASE("Sweep: a run count that overflows size_t is 0", "[sweep]") {
+    App::Sweep::Plan plan;
+    App::Sweep::Dimension d;
+    std::string err;
+    REQUIRE(App::Sweep::ParseDimension("brake.max_decel_mps2=2:6:1000000", App::Sweep::Dist::Grid, d, err));
+    plan.dims.assign(3, d);
+    plan.samples = 10;
+    REQUIRE(App::Sweep::RunCount(plan) == 10000000000000000000u);
+    plan.samples = 20;
+    REQUIRE(App::Sweep::RunCount(plan) == 0);
+}
+
+TEST_CASE("Sweep: stronger brakes stop in a shorter distance", "[sweep]") {
+    Rte::Calibration weak{};
+    weak.brake.max_decel_mps2 = 2.0f;
+    Rte::Calibration strong{};
+    strong.brake.max_decel_mps2 = 6.0f;
+
+    const auto w = App::Sweep::RunScenario(weak, 10.0);
+    const auto s = App::Sweep::RunScenario(strong, 10.0);
+    REQUIRE(w.stopping_distance_m > 0.0f);
+    REQUIRE(s.stopping_distance_m > 0.0f);
+    REQUIRE(s.stopping_distance_m < w.stopping_distance_m);
+    REQUIRE(s.final_state.v == 0.0f);
+}
@@ -0,0 +1,216 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "app/ecu.h"
+#include "bsw/timebase.h"
+#include "rte/rte.h"
+
+namespace {
+
+std::string Trace(bool paced)
+{
+    std::string trace;
+    Bsw::TimeBase::Scheduler sched;
+    sched.AddTask10ms([&] { trace += 'a'; });
+    sched.AddTask20ms([&] { trace += 'b'; });
+    sched.AddTask100ms([&] { trace += 'c'; });
+    if (paced) {
+        Bsw::TimeBase::PacingConfig cfg;
+        cfg.speed_factor = 0.0; // as fast as possible
+        cfg.print_report = false;
+        sched.RunPaced(0.55, cfg);
+    } else {
+        sched.RunForSeconds(0.55);
+    }
+    return trace;
+}
+
+std::string ThreadedTrace(int64_t start_tick)
+{
+    std::string trace;
+    Bsw::TimeBase::Scheduler sched;
+    sched.SetTick(start_tick);
+    sched.SetTickPrologue([&] { trace += 'p'; });
+    sched.AddTask10ms([&] { trace += 'a'; });
+    sched.AddTask20ms([&] { trace += 'b'; });
+    sched.AddTask100ms([&] { trace += 'c'; });
+    Bsw::TimeBase::ThreadedConfig cfg;
+    cfg.print_report = false;
+    sched.RunThreaded(0.55, cfg);
+    REQUIRE(sched.Tick() == start_tick + 55);
+    return trace;
+}
+
+} // namespace
+
+TEST_CASE("Scheduler: paced mode runs the same task sequence", "[timebase]") {
+    REQUIRE(Trace(true) == Trace(false));
+}
+
+TEST_CASE("Scheduler: paced mode holds the wall-clock period", "[timebase]") {
+    Bsw::TimeBase::Scheduler sched;
+    int ticks = 0;
+    sched.AddTask10ms([&] { ++ticks; });
+
+    Bsw::TimeBase::PacingConfig cfg;
+    cfg.speed_factor = 10.0; // 1ms wall clock per 10ms tick
+    cfg.print_report = false;
+
+    const int64_t t0 = Bsw::TimeBase::MonotonicNowNs();
+    const auto stats = sched.RunPaced(0.5, cfg);
+    const int64_t elapsed = Bsw::TimeBase::MonotonicNowNs() - t0;
+
+    REQUIRE(ticks == 50);
+    REQUIRE(stats.ticks == 50);
+    REQUIRE(stats.period_ns == 1000000);
+    // 49 full periods must have elapsed before the last release
+    REQUIRE(elapsed >= 49 * stats.period_ns);
+    REQUIRE(stats.jitter_min_ns >= 0);
+    REQUIRE(stats.JitterQuantileNs(1.0) >= stats.jitter_max_ns);
+}
+
+TEST_CASE("Scheduler: deterministic threaded mode runs the single-thread sequence", "[timebase]") {
+    for (int64_t start_tick : {0, 3}) {
+        std::string expected;
+        Bsw::TimeBase::Scheduler sched;
+        sched.SetTick(start_tick);
+        sched.SetTickPrologue([&] { expected += 'p'; });
+        sched.AddTask10ms([&] { expected += 'a'; });
+        sched.AddTask20ms([&] { expected += 'b'; });
+        sched.AddTask100ms([&] { expected += 'c'; });
+        sched.RunForSeconds(0.55);
+
+        for (int round = 0; round < 20; ++round) {
+            REQUIRE(ThreadedTrace(start_tick) == expected);
+        }
+    }
+}
+
+TEST_CASE("Scheduler: deterministic threaded mode reproduces the ECU bit for bit", "[timebase]") {
+    Rte::Context serial;
+    App::InitEcu(serial);
+    App::StaticScheduler::RunForSeconds(10.0, serial);
+
+    Rte::Context threaded;
+    App::InitEcu(threaded);
+    Bsw::TimeBase::Scheduler sched;
+    App::RegisterTasks(sched, threaded);
+    Bsw::TimeBase::ThreadedConfig cfg;
+    cfg.print_report = false;
+    const auto stats = sched.RunThreaded(10.0, cfg);
+
+    REQUIRE(stats.rates[0].activations == 1000);
+    REQUIRE(stats.rates[1].activations == 500);
+    REQUIRE(stats.rates[2].activations == 100);
+    const auto st_s = Rte::Rte_Read_VehicleState(serial);
+    const auto st_t = Rte::Rte_Read_VehicleState(threaded);
+    const auto sf_s = Rte::Rte_Read_Safety(serial);
+    const auto sf_t = Rte::Rte_Read_Safety(threaded);
+    REQUIRE(std::memcmp(&st_s, &st_t, sizeof(Rte::VehicleState)) == 0);
+    REQUIRE(sf_s.estop == sf_t.estop);
+    REQUIRE(sf_s.system_state == sf_t.system_state);
+}
+
+TEST_CASE("Scheduler: free-running threaded mode releases each rate on its own thread", "[timebase]") {
+    std::mutex m;
+    std::set<std::thread::id> ids[3];
+    auto record = [&](int r) {
+        return [&, r] {
+            std::lock_guard<std::mutex> lk(m);
+            ids[r].insert(std::this_thread::get_id());
+        };
+    };
+    Bsw::TimeBase::Scheduler sched;
+    sched.SetTick(5); // 20/100ms phases continue from the tick counter
+    sched.AddTask10ms(record(0));
+    sched.AddTask20ms(record(1));
+    sched.AddTask100ms(record(2));
+
+    Bsw::TimeBase::ThreadedConfig cfg;
+    cfg.deterministic = false;
+    cfg.speed_factor = 10.0; // 1ms wall clock per 10ms tick
+    cfg.rates[0].cpu = 0;
+    cfg.print_report = false;
+
+    const int64_t t0 = Bsw::TimeBase::MonotonicNowNs();
+    const auto stats = sched.RunThreaded(0.5, cfg);
+    const int64_t elapsed = Bsw::TimeBase::MonotonicNowNs() - t0;
+
+    REQUIRE(sched.Tick() == 55);
+    REQUIRE(stats.period_ns == 1000000);
+    REQUIRE(elapsed >= 49 * stats.period_ns);
+    REQUIRE(stats.rates[0].activations == 50);
+    REQUIRE(stats.rates[1].activations == 25); // ticks 6, 8, ..., 54
+    REQUIRE(stats.rates[2].activations == 5);  // ticks 10, 20, ..., 50
+    REQUIRE(stats.rates[0].affinity_applied);
+    REQUIRE(!stats.rates[1].affinity_applied); // not requested
+    for (const auto& s : ids) REQUIRE(s.size() == 1);
+    REQUIRE(*ids[0].begin() != *ids[1].begin());
+    REQUIRE(*ids[1].begin() != *ids[2].begin());
+    REQUIRE(*ids[0].begin() != std::this_thread::get_id());
+}
+
+TEST_CASE("Scheduler: data-triggered task runs only when its inputs changed", "[timebase]") {
+    uint64_t seq = 0;
+    int runs = 0;
+    int skips = 0;
+    Bsw::TimeBase::Scheduler sched;
+    Bsw::TimeBase::DataTrigger trigger;
+    trigger.inputs = [&] { return seq; };
+    trigger.on_skip = [&] { ++skips; };
+    sched.AddTask10ms([&] { ++runs; }, "triggered", trigger);
+    sched.AddTask20ms([&] { ++seq; }, "producer20ms");
+
+    sched.RunForSeconds(1.0);
+    // Tick 0 runs (first activation); afterwards only ticks following a producer write
+    REQUIRE(runs == 51);
+    REQUIRE(skips == 49);
+
+    const auto t = sched.Triggers();
+    REQUIRE(t.size() == 1);
+    REQUIRE(std::string(t[0].name) == "triggered");
+    REQUIRE(t[0].rate_ms == 10);
+    REQUIRE(t[0].activations == 100);
+    REQUIRE(t[0].skipped == 49);
+}
+
+TEST_CASE("Scheduler: data-received ECU triggering matches periodic bit for bit", "[timebase]") {
+    auto run = [](Rte::Context& ctx, App::Triggering triggering) {
+        App::InitEcu(ctx);
+        Bsw::TimeBase::Scheduler sched;
+        App::RegisterTasks(sched, ctx, triggering);
+        sched.RunForSeconds(5.0);
+        // Calibration swapped mid-run (as Calib::Store::Apply does) must re-trigger
+        ctx.calib.brake.max_decel_mps2 = 3.0f;
+        ++ctx.calib_seq;
+        sched.RunForSeconds(5.0);
+        return sched.Triggers();
+    };
+
+    Rte::Context periodic;
+    Rte::Context triggered;
+    REQUIRE(run(periodic, App::Triggering::Periodic).empty());
+    const auto t = run(triggered, App::Triggering::DataReceived);
+
+    const auto st_p = Rte::Rte_Read_VehicleState(periodic);
+    const auto st_t = Rte::Rte_Read_VehicleState(triggered);
+    const auto cmd_p = Rte::Rte_Read_ActuatorCmd(periodic);
+    const auto cmd_t = Rte::Rte_Read_ActuatorCmd(triggered);
+    REQUIRE(std::memcmp(&st_p, &st_t, sizeof(Rte::VehicleState)) == 0);
+    REQUIRE(std::memcmp(&cmd_p, &cmd_t, sizeof(Rte::ActuatorCmd)) == 0);
+    // Skipped activations keep alive supervision fed
+    REQUIRE(Rte::Rte_Read_Safety(triggered).system_state == Rte::Rte_Read_Safety(periodic).system_state);
+    REQUIRE(Bsw::Diag::GetMissedDeadlines(triggered, Rte::SupervisedEntity::Engine) == 0);
+
+    REQUIRE(t.size() == 2);
+    for (const auto& e : t) {
+        REQUIRE(e.activations == 1000);
+        // DriverInput is rewritten every 20ms after the 10ms tasks: every even tick
+        // but the first and the one after the calibration swap sees no new input
+        REQUIRE(e.skipped == 498);
+    }
+}
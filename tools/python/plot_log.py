@@ -1,22 +1,76 @@
 #!/usr/bin/env python3
+# usage: plot_log.py [LOG]   (.sdvlog or .csv; default: the newer of logs/latest.sdvlog and logs/latest.csv)
+import argparse
 import csv
+import struct
 from pathlib import Path
-import matplotlib.pyplot as plt
+import numpy as np
 
-def main():
-    root = Path(__file__).resolve().parents[2]
-    log_path = root / "logs" / "latest.csv"
-    if not log_path.exists():
-        raise SystemExit(f"Log not found: {log_path}")
+# Layout: src/bsw/columnar_log.h
+_COL_DTYPES = {1: np.float32, 2: np.uint8}
+
+
+def read_columnar(path, names):
+    """Reads the requested columns of a .sdvlog into numpy arrays."""
+    buf = np.memmap(path, dtype=np.uint8, mode="r")
+    magic, version, ncols, _chunk_rows, _ = struct.unpack_from("<8sIIII", buf, 0)
+    if magic != b"SDVCLOG1" or version != 1:
+        raise SystemExit(f"Not a columnar log: {path}")
+    pos = 24
+    schema = []
+    for _ in range(ncols):
+        raw, typ = struct.unpack_from("<31sB", buf, pos)
+        schema.append((raw.split(b"\0")[0].decode(), _COL_DTYPES[typ]))
+        pos += 32
 
-    t, v, omega, yaw = [], [], [], []
-    with log_path.open() as f:
+    parts = {n: [] for n in names}
+    while pos + 16 <= len(buf):
+        cmagic, rows, payload = struct.unpack_from("<4sIQ", buf, pos)
+        if cmagic != b"CHNK" or pos + 16 + payload > len(buf):
+            break  # truncated tail
+        off = pos + 16
+        for name, dtype in schema:
+            nbytes = rows * np.dtype(dtype).itemsize
+            if name in parts:
+                parts[name].append(np.frombuffer(buf, dtype=dtype, count=rows, offset=off))
+            off += (nbytes + 7) & ~7
+        pos += 16 + payload
+    return {n: (np.concatenate(p) if p else np.array([])) for n, p in parts.items()}
+
+
+def read_csv(path, names):
+    cols = {n: [] for n in names}
+    with path.open() as f:
         reader = csv.DictReader(f)
         for row in reader:
-            t.append(float(row["t"]))
-            v.append(float(row["v"]))
-            omega.append(float(row["wheel_omega"]))
-            yaw.append(float(row["yaw"]))
+            for n in names:
+                cols[n].append(float(row[n]))
+    return cols
+
+
+def newest_log(log_dir):
+    """The most recently written of latest.sdvlog / latest.csv, or None."""
+    found = [p for p in (log_dir / "latest.sdvlog", log_dir / "latest.csv") if p.exists()]
+    return max(found, key=lambda p: p.stat().st_mtime_ns) if found else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Plot speed, wheel speed and yaw of an sdv_sim log")
+    parser.add_argument("log", nargs="?", type=Path, help=".sdvlog or .csv (default: newest in logs/)")
+    args = parser.parse_args()
+    root = Path(__file__).resolve().parents[2]
+    log_path = args.log or newest_log(root / "logs")
+    if log_path is None or not log_path.exists():
+        raise SystemExit(f"Log not found: {log_path or root / 'logs' / 'latest.csv'}")
+
+    names = ["t", "v", "wheel_omega", "yaw"]
+    if log_path.suffix == ".sdvlog":
+        cols = read_columnar(log_path, names)
+    else:
+        cols = read_csv(log_path, names)
+    t, v, omega, yaw = (cols[n] for n in names)
+
+    import matplotlib.pyplot as plt  # only needed for plotting, not for the readers
 
     plt.figure()
     plt.plot(t, v)
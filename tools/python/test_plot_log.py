@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+# Readers of plot_log.py; run with: python3 -m unittest discover -s tools/python -p "test_*.py"
+import os
+import struct
+import tempfile
+import unittest
+from pathlib import Path
+
+import numpy as np
+
+from plot_log import newest_log, read_columnar, read_csv
+
+
+def _pad8(b):
+    return b + b"\0" * (-len(b) % 8)
+
+
+def write_sdvlog(path, schema, chunks, tail=b""):
+    """schema: [(name, type)] with 1 = f32, 2 = u8; chunks: [{name: values}] (layout: src/bsw/columnar_log.h)."""
+    out = struct.pack("<8sIIII", b"SDVCLOG1", 1, len(schema), 4096, 0)
+    for name, typ in schema:
+        out += struct.pack("<31sB", name.encode(), typ)
+    for chunk in chunks:
+        rows = len(chunk[schema[0][0]])
+        payload = b"".join(
+            _pad8(np.asarray(chunk[name], dtype=np.float32 if typ == 1 else np.uint8).tobytes())
+            for name, typ in schema)
+        out += struct.pack("<4sIQ", b"CHNK", rows, len(payload)) + payload
+    path.write_bytes(out + tail)
+
+
+class ReadColumnarTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.dir = Path(self.tmp.name)
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def test_columns_span_chunks_and_skip_padding(self):
+        path = self.dir / "a.sdvlog"
+        schema = [("t", 1), ("estop", 2), ("v", 1)]
+        write_sdvlog(path, schema, [
+            {"t": [0.0, 0.01, 0.02], "estop": [0, 0, 1], "v": [1.0, 2.0, 3.0]},
+            {"t": [0.03], "estop": [1], "v": [4.0]},
+        ])
+        cols = read_columnar(path, ["t", "v", "estop"])
+        np.testing.assert_array_equal(cols["t"], np.array([0.0, 0.01, 0.02, 0.03], dtype=np.float32))
+        np.testing.assert_array_equal(cols["v"], [1.0, 2.0, 3.0, 4.0])
+        np.testing.assert_array_equal(cols["estop"], [0, 0, 1, 1])
+        self.assertEqual(cols["estop"].dtype, np.uint8)
+
+    def test_truncated_tail_keeps_complete_chunks(self):
+        path = self.dir / "cut.sdvlog"
+        header = struct.pack("<4sIQ", b"CHNK", 5, 64)
+        write_sdvlog(path, [("t", 1)], [{"t": [0.0, 0.01]}], tail=header + b"\0" * 10)
+        np.testing.assert_array_equal(read_columnar(path, ["t"])["t"], np.array([0.0, 0.01], dtype=np.float32))
+
+    def test_rejects_other_files(self):
+        path = self.dir / "x.sdvlog"
+        path.write_bytes(b"t,v\n" + b"\0" * 40)
+        with self.assertRaises(SystemExit):
+            read_columnar(path, ["t"])
+
+    def test_csv_reader(self):
+        path = self.dir / "a.csv"
+        path.write_text("t,v,x\n0.00,1.5,9\n0.01,2.5,9\n")
+        self.assertEqual(read_csv(path, ["t", "v"]), {"t": [0.0, 0.01], "v": [1.5, 2.5]})
+
+
+class NewestLogTest(unittest.TestCase):
+    def test_picks_the_most_recently_written_format(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            d = Path(tmp)
+            self.assertIsNone(newest_log(d))
+            binary, text = d / "latest.sdvlog", d / "latest.csv"
+            binary.write_bytes(b"")
+            text.write_text("")
+            os.utime(binary, ns=(2_000_000_000, 2_000_000_000))
+            os.utime(text, ns=(1_000_000_000, 1_000_000_000))
+            self.assertEqual(newest_log(d), binary)
+            os.utime(text, ns=(3_000_000_000, 3_000_000_000))
+            self.assertEqual(newest_log(d), text)
+
+
+if __name__ == "__main__":
+    unittest.main()